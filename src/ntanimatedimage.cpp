@@ -0,0 +1,384 @@
+/*!	\file		ntanimatedimage.cpp
+ *	\brief		Implementation of thread-safe NTAnimatedImage class
+ *	\details	Contains method implementations for sprite sheet animation in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntanimatedimage.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+#include <climits>
+
+// Default constructor
+NTAnimatedImage::NTAnimatedImage(NTObject* parent, const std::string& name)
+	: NTAnimatedImage(parent, name, nullptr, 0, 0, 0, A_NORMAL, NTA_NONE)
+{
+}
+
+// Parameterized constructor
+NTAnimatedImage::NTAnimatedImage(NTObject *parent, const std::string& name,
+								 std::shared_ptr<const NTSpriteSheet> sheet,
+								 int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the left-top corner of the image
+	colorPair,						// Color pair to draw from the palette
+	attr,							// attr
+	ntattr),						// ntattr
+	_sheet(std::move(sheet)),		// sprite sheet
+	_frame(0),						// first frame
+	_loopMode(NT_LOOP_REPEAT),		// loop mode
+	_direction(1),					// forward
+	_playing(false),				// stopped
+	_timers(nullptr), _timer(0),	// no timer wheel
+	_drawn(false), _drawnFrame(0), _drawnX(0), _drawnY(0),
+	_drawnColorPair(0), _drawnAttr(0), _drawnNtattr(NTA_NONE)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	//notifyObservers();
+}
+
+// Copy constructor
+NTAnimatedImage::NTAnimatedImage(const NTAnimatedImage& other)
+	: NTGraphicObject(other.parent(), other.name(),	// parent, name
+	other._x, other._y,								// x, y coordinate of the left-top corner of the image
+	other._colorPair,								// Color pair to draw from the palette
+	other._attr,									// attr
+	other._ntattr),									// ntattr
+	_timers(nullptr), _timer(0),
+	_drawn(false), _drawnFrame(0), _drawnX(0), _drawnY(0),
+	_drawnColorPair(0), _drawnAttr(0), _drawnNtattr(NTA_NONE)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::lock_guard<std::mutex> other_lock(other._mutex);
+	_sheet = other._sheet;
+	_frame = other._frame;
+	_loopMode = other._loopMode;
+	_direction = other._direction;
+	_playing = other._playing;
+	_frameStart = other._frameStart;
+	//notifyObservers();
+}
+
+// Destructor
+NTAnimatedImage::~NTAnimatedImage()
+{
+	// A running update() takes the mutex and must not arm a new timer,
+	// so the wheel is dropped first and the timer is cancelled unlocked
+	NTTimerWheel *timers;
+	NTTimerWheel::Id timer;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		timers = _timers;
+		timer = _timer;
+		_timers = nullptr;
+		_timer = 0;
+	}
+	if (timers) timers->cancel(timer);
+}
+
+// Assignment operator
+NTAnimatedImage& NTAnimatedImage::operator=(const NTAnimatedImage& other)
+{
+	if (this != &other) {
+		std::unique_lock<std::mutex> lock1(_mutex, std::defer_lock);
+		std::unique_lock<std::mutex> lock2(other._mutex, std::defer_lock);
+		std::lock(lock1, lock2);
+
+		NTObject::operator=(other);
+		_sheet = other._sheet;
+		_frame = other._frame;
+		_loopMode = other._loopMode;
+		_direction = other._direction;
+		_playing = other._playing;
+		_frameStart = other._frameStart;
+		_x = other._x;
+		_y = other._y;
+		_colorPair = other._colorPair;
+		_attr = other._attr;
+		_ntattr = other._ntattr;
+		_drawn = false;
+		_changed = true;
+		placed();
+		arm();
+	}
+	//notifyObservers();
+	return *this;
+}
+
+// Sets the sprite sheet
+void NTAnimatedImage::setSheet(std::shared_ptr<const NTSpriteSheet> sheet)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sheet = std::move(sheet);
+	_frame = 0;
+	_direction = 1;
+	_frameStart = std::chrono::steady_clock::now();
+	_drawn = false;
+	_changed = true;
+	placed();
+	arm();
+	//notifyObservers();
+}
+
+// Gets the sprite sheet
+std::shared_ptr<const NTSpriteSheet> NTAnimatedImage::sheet() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _sheet;
+}
+
+// Sets the current frame
+void NTAnimatedImage::setFrame(unsigned int frame)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_sheet || frame >= _sheet->frameCount() || frame == _frame) return;
+	_frame = frame;
+	_frameStart = std::chrono::steady_clock::now();
+	_changed = true;
+	arm();
+	//notifyObservers();
+}
+
+// Gets the current frame
+unsigned int NTAnimatedImage::frame() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _frame;
+}
+
+// Sets the loop mode
+void NTAnimatedImage::setLoopMode(int mode)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_loopMode = mode;
+	_direction = 1;
+}
+
+// Gets the loop mode
+int NTAnimatedImage::loopMode() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _loopMode;
+}
+
+// Starts the playback from the current frame
+void NTAnimatedImage::play()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_playing = true;
+	_frameStart = std::chrono::steady_clock::now();
+	arm();
+}
+
+// Stops the playback on the current frame
+void NTAnimatedImage::stop()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_playing = false;
+	arm();
+}
+
+// Plays the animation on a timer wheel
+void NTAnimatedImage::setTimers(NTTimerWheel *timers)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_timers) _timers->cancel(_timer, false);
+	_timer = 0;
+	_timers = timers;
+	arm();
+}
+
+// Sets the timer for the end of the current frame
+void NTAnimatedImage::arm()
+{
+	if (!_timers) return;
+	_timers->cancel(_timer, false);
+	_timer = 0;
+	if (!_playing || !_sheet || _sheet->frameCount() < 2) return;
+
+	auto left = std::chrono::milliseconds(_sheet->duration(_frame)) - (std::chrono::steady_clock::now() - _frameStart);
+	_timer = _timers->after(std::chrono::duration_cast<std::chrono::microseconds>(left), [this]() { update(); });
+}
+
+// Gets the playback state
+bool NTAnimatedImage::isPlaying() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _playing;
+}
+
+// Steps to the next frame according to the loop mode
+void NTAnimatedImage::step()
+{
+	unsigned int frames = _sheet->frameCount();
+
+	switch (_loopMode) {
+	case NT_LOOP_ONCE:
+		if (_frame + 1 < frames) {
+			_frame++;
+		} else {
+			_playing = false;
+		}
+		break;
+	case NT_LOOP_PINGPONG:
+		if ((_direction > 0 && _frame + 1 >= frames) || (_direction < 0 && _frame == 0)) {
+			_direction = -_direction;
+		}
+		_frame += _direction;
+		break;
+	default:
+		_frame = (_frame + 1) % frames;
+		break;
+	}
+}
+
+// Advances the animation by the elapsed time
+bool NTAnimatedImage::update(std::chrono::steady_clock::time_point now)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_playing || !_sheet || _sheet->frameCount() < 2) return false;
+
+	unsigned int old_frame = _frame;
+	while (_playing) {
+		auto duration = std::chrono::milliseconds(_sheet->duration(_frame));
+		if (now - _frameStart < duration) break;
+
+		// Zero duration shows the next frame on every update
+		if (duration.count() == 0) {
+			_frameStart = now;
+			step();
+			break;
+		}
+
+		_frameStart += duration;
+		step();
+	}
+
+	arm();
+	if (_frame == old_frame) return false;
+	_changed = true;
+	return true;
+}
+
+// Gets the area covered by the frame
+nt::Rect NTAnimatedImage::area() const
+{
+	if (!_sheet) return {_x, _y, 0, 0};
+	return {_x, _y, static_cast<int>(_sheet->width()), static_cast<int>(_sheet->height())};
+}
+
+// Gets the area the next draw() repaints
+nt::Rect NTAnimatedImage::dirtyArea() const
+{
+	const std::vector<nt::Span> *spans = delta();
+	if (!spans) return area();
+
+	int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+	for (const nt::Span &span : *spans) {
+		x0 = std::min(x0, _x + static_cast<int>(span.x));
+		y0 = std::min(y0, _y + static_cast<int>(span.y));
+		x1 = std::max(x1, _x + static_cast<int>(span.x + span.length));
+		y1 = std::max(y1, _y + static_cast<int>(span.y) + 1);
+	}
+	if (x0 > x1) return {_x, _y, 0, 0};
+	return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// Gets the spans to redraw over the frame on the screen
+const std::vector<nt::Span> *NTAnimatedImage::delta() const
+{
+	if (!_drawn || _drawnX != _x || _drawnY != _y || _drawnColorPair != _colorPair ||
+		_drawnAttr != _attr || _drawnNtattr != _ntattr) return nullptr;
+	return _sheet->delta(_drawnFrame, _frame);
+}
+
+// Frames are padded to the sheet width, so only transparency matters
+bool NTAnimatedImage::opaque() const
+{
+	return !(_ntattr & NTA_SPACE_TRANSPARENT);
+}
+
+// Forces a full redraw on the next draw()
+void NTAnimatedImage::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_drawn = false;
+	_changed = true;
+}
+
+// Draw the current frame
+int NTAnimatedImage::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	if (!_sheet || _sheet->frameCount() == 0) return NT_ERR;
+
+	int width = static_cast<int>(_sheet->width());
+	int height = static_cast<int>(_sheet->height());
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + height <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + width <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	// Redraw only the spans if the previous frame is on the screen as it was.
+	// A screen cleared the bounds of the spans (dirtyArea()), so the whole
+	// frame is drawn there: the occlusion map keeps it to the cleared cells
+	const std::vector<nt::Span> *spans = _occlusion ? nullptr : delta();
+
+	if (spans) {
+		for (const nt::Span &span : *spans) {
+			int y = _y + span.y;
+			if (y < 0 || y >= max_y) continue;
+			if (drawColumns(y, _x, _sheet->row(_frame, span.y), _sheet->layout(_frame, span.y),
+							span.x, span.x + span.length, max_x) == ERR) {
+				result = ERR;
+			}
+		}
+	} else {
+		// Get the visible rows
+		int visible_vstart = _y < 0 ? 0 - _y : 0;
+		int visible_vlength = std::min(height, max_y - _y);
+
+		for (int y = visible_vstart; y < visible_vlength; y++) {
+			if (drawText(_y + y, _x, _sheet->row(_frame, y), _sheet->layout(_frame, y), max_x) == ERR) {
+				result = ERR;
+			}
+		}
+	}
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// Remember what is on the screen
+	_drawn = true;
+	_drawnFrame = _frame;
+	_drawnX = _x;
+	_drawnY = _y;
+	_drawnColorPair = _colorPair;
+	_drawnAttr = _attr;
+	_drawnNtattr = _ntattr;
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
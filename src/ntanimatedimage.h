@@ -0,0 +1,206 @@
+/*! \file       ntanimatedimage.h
+ *  \brief      NT Animated image module (header file).
+ *  \details    Contains the NTAnimatedImage class definitions for sprite
+ *              sheet animation in the NT system.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTANIMATEDIMAGE_H_
+#define _NTANIMATEDIMAGE_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Time library */
+#include <chrono>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  Sprite sheet */
+#include "ntspritesheet.h"
+/*! \brief  Timer service */
+#include "nttimerwheel.h"
+
+/* Loop modes */
+constexpr int NT_LOOP_ONCE		= 0;	/*!< Play once and stop on the last frame */
+constexpr int NT_LOOP_REPEAT	= 1;	/*!< Start over from the first frame */
+constexpr int NT_LOOP_PINGPONG	= 2;	/*!< Play forward, then backward */
+
+/*! \class      NTAnimatedImage
+ *  \brief      Sprite sheet animation class for NT system.
+ *  \details    Shows one frame of a shared NTSpriteSheet. Switching the frame
+ *              only changes the index. When the frame on the screen and the
+ *              new frame are neighbours and nothing else changed, draw()
+ *              redraws only the spans precomputed by the sheet.
+ *  \extends    NTGraphicObject
+ */
+class NTAnimatedImage : public NTGraphicObject
+{
+public:
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    Image name (default: empty string)
+	 */
+	NTAnimatedImage(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent      Pointer to the parent object
+	 *  \param      name        Image name
+	 *  \param      sheet       Shared sprite sheet
+	 *  \param      x           X coordinate of the image
+	 *  \param      y           Y coordinate of the image
+	 *	\param		colorPair	Color pair to draw from the palette
+	 *	\param		attr		Attr for the image
+	 *	\param      ntattr		nt attr for the image
+	 */
+	NTAnimatedImage(NTObject *parent, const std::string& name,
+					std::shared_ptr<const NTSpriteSheet> sheet,
+					int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr);
+
+	/*! \brief  Destructor */
+	~NTAnimatedImage();
+
+	/*! \brief      Copy constructor
+	 *  \param      other   Reference to source NTAnimatedImage object
+	 */
+	NTAnimatedImage(const NTAnimatedImage& other);
+
+	/*! \brief      Assignment operator
+	 *  \param      other   Reference to source NTAnimatedImage object
+	 *  \return     Reference to the assigned NTAnimatedImage object
+	 */
+	NTAnimatedImage& operator=(const NTAnimatedImage& other);
+
+	/*! \brief      Sets the sprite sheet
+	 *  \param      sheet   Shared sprite sheet
+	 */
+	void setSheet(std::shared_ptr<const NTSpriteSheet> sheet);
+
+	/*! \brief      Gets the sprite sheet
+	 *  \return     Shared sprite sheet
+	 */
+	std::shared_ptr<const NTSpriteSheet> sheet() const;
+
+	/*! \brief      Sets the current frame
+	 *  \param      frame   Frame index (ignored if out of range)
+	 */
+	void setFrame(unsigned int frame);
+
+	/*! \brief      Gets the current frame
+	 *  \return     Frame index
+	 */
+	unsigned int frame() const;
+
+	/*! \brief      Sets the loop mode
+	 *  \param      mode    NT_LOOP_ONCE, NT_LOOP_REPEAT or NT_LOOP_PINGPONG
+	 */
+	void setLoopMode(int mode);
+
+	/*! \brief      Gets the loop mode
+	 *  \return     Loop mode
+	 */
+	int loopMode() const;
+
+	/*! \brief  Starts the playback from the current frame */
+	void play();
+
+	/*! \brief  Stops the playback on the current frame */
+	void stop();
+
+	/*! \brief      Gets the playback state
+	 *  \return     true if playing, false otherwise
+	 */
+	bool isPlaying() const;
+
+	/*! \brief      Plays the animation on a timer wheel
+	 *  \details    While playing, a timer of the wheel calls update() when the
+	 *              frame ends, so the loop does not have to. Copies do not
+	 *              take the wheel. The timer is cancelled by stop(), by another
+	 *              wheel and by the destructor; the destructor also waits for
+	 *              an update() the wheel is running on another thread, so the
+	 *              image may be destroyed while advance() runs elsewhere.
+	 *  \param      timers  Timer wheel (nullptr - update() is called by the owner)
+	 */
+	void setTimers(NTTimerWheel *timers);
+
+	/*! \brief      Forces a full redraw of the frame on the next draw() */
+	void invalidate() override;
+
+	/*! \brief      Advances the animation by the elapsed time
+	 *  \details    Uses the per-frame durations of the sheet.
+	 *  \param      now     Current time
+	 *  \return     true if the frame changed, false otherwise
+	 */
+	bool update(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+	/*! \brief     Draw the current frame
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the frame
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Gets the area the next draw() repaints
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Bounds of the spans that differ from the frame on the
+	 *              screen, or the whole frame
+	 */
+	nt::Rect dirtyArea() const override;
+
+	/*! \brief      Checks if the frame overwrites every cell of its area
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if opaque, false otherwise
+	 */
+	bool opaque() const override;
+
+private:
+	/*! \brief      Steps to the next frame according to the loop mode
+	 *  \details    Must be called with _mutex held.
+	 */
+	void step();
+
+	/*! \brief      Gets the spans to redraw over the frame on the screen
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Spans, or nullptr if the whole frame must be drawn
+	 */
+	const std::vector<nt::Span> *delta() const;
+
+	/*! \brief      Sets the timer for the end of the current frame
+	 *  \details    Must be called with _mutex held.
+	 */
+	void arm();
+
+	std::shared_ptr<const NTSpriteSheet> _sheet;		/*!< Shared sprite sheet */
+	unsigned int _frame;								/*!< Current frame */
+	int _loopMode;										/*!< Loop mode */
+	int _direction;										/*!< Step direction (ping-pong) */
+	bool _playing;										/*!< Playback state */
+	std::chrono::steady_clock::time_point _frameStart;	/*!< Time the current frame was shown */
+	NTTimerWheel *_timers;								/*!< Timer wheel (nullptr - none) */
+	NTTimerWheel::Id _timer;							/*!< Timer of the current frame (0 - none) */
+
+	bool _drawn;					/*!< Frame is on the screen */
+	unsigned int _drawnFrame;		/*!< Frame on the screen */
+	int _drawnX;					/*!< X coordinate of the frame on the screen */
+	int _drawnY;					/*!< Y coordinate of the frame on the screen */
+	unsigned char _drawnColorPair;	/*!< Color pair of the frame on the screen */
+	chtype _drawnAttr;				/*!< Attr of the frame on the screen */
+	unsigned char _drawnNtattr;		/*!< nt attr of the frame on the screen */
+};
+
+#endif // _NTANIMATEDIMAGE_H_
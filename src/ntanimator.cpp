@@ -0,0 +1,206 @@
+/*!	\file		ntanimator.cpp
+ *	\brief		Implementation of the NTAnimator class
+ *	\details	Contains method implementations for the tween engine in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntanimator.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Function objects */
+#include <functional>
+/*! \brief  Rounding */
+#include <cmath>
+
+namespace {
+	// Gets the eased progress
+	double ease(int easing, double t)
+	{
+		switch (easing) {
+		case NTE_IN:
+			return t * t * t;
+		case NTE_OUT:
+			return 1.0 - (1.0 - t) * (1.0 - t) * (1.0 - t);
+		case NTE_IN_OUT:
+			return t < 0.5 ? 4.0 * t * t * t : 1.0 - 4.0 * (1.0 - t) * (1.0 - t) * (1.0 - t);
+		default:
+			return t;
+		}
+	}
+
+	// Interpolates a value
+	int mix(int from, int to, double e)
+	{
+		return from + static_cast<int>(std::lround((to - from) * e));
+	}
+
+	// Checks if the colors are equal
+	bool same(const nt::Color &a, const nt::Color &b)
+	{
+		return a.red == b.red && a.green == b.green && a.blue == b.blue;
+	}
+}
+
+// Constructor
+NTAnimator::NTAnimator()
+	: _next(1) {}
+
+// Destructor
+NTAnimator::~NTAnimator() = default;
+
+// Tweens a coordinate of a widget
+NTAnimator::Id NTAnimator::tween(NTGraphicObject *object, int property, int to, std::chrono::milliseconds duration, int easing)
+{
+	if (property != NTT_X && property != NTT_Y) return 0;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	int from;
+	{
+		std::lock_guard<std::mutex> object_lock(object->_mutex);
+		from = property == NTT_X ? object->_x : object->_y;
+	}
+	return insert({0, object, property, easing, from, to, 0, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+				   std::chrono::steady_clock::now(), duration});
+}
+
+// Tweens the position of a widget
+NTAnimator::Id NTAnimator::move(NTGraphicObject *object, int x, int y, std::chrono::milliseconds duration, int easing)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int from_x, from_y;
+	{
+		std::lock_guard<std::mutex> object_lock(object->_mutex);
+		from_x = object->_x;
+		from_y = object->_y;
+	}
+
+	// Both coordinates share one handle
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	Id id = insert({0, object, NTT_X, easing, from_x, x, 0, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, now, duration});
+	return insert({id, object, NTT_Y, easing, from_y, y, 0, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, now, duration});
+}
+
+// Tweens a palette color used by a widget
+NTAnimator::Id NTAnimator::fade(NTGraphicObject *object, short color, nt::Color to, std::chrono::milliseconds duration, int easing)
+{
+	// The tween starts from the color the palette has now
+	nt::Color from = to;
+	short red, green, blue;
+	if (color_content(color, &red, &green, &blue) == OK) {
+		from = {static_cast<unsigned char>(red * 255 / 1000), static_cast<unsigned char>(green * 255 / 1000),
+				static_cast<unsigned char>(blue * 255 / 1000)};
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	return insert({0, object, NTT_COLOR, easing, 0, 0, color, from, to, from, std::chrono::steady_clock::now(), duration});
+}
+
+// Cancels a tween
+bool NTAnimator::cancel(Id id)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = std::remove_if(_tweens.begin(), _tweens.end(), [id](const Tween &tween) { return tween.id == id; });
+	if (it == _tweens.end()) return false;
+	_tweens.erase(it, _tweens.end());
+	return true;
+}
+
+// Cancels all the tweens of a widget
+void NTAnimator::stop(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_tweens.erase(std::remove_if(_tweens.begin(), _tweens.end(),
+								 [object](const Tween &tween) { return tween.object == object; }),
+				  _tweens.end());
+}
+
+// Checks if a tween is running
+bool NTAnimator::active(Id id) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return std::any_of(_tweens.begin(), _tweens.end(), [id](const Tween &tween) { return tween.id == id; });
+}
+
+// Gets the number of running tweens
+size_t NTAnimator::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tweens.size();
+}
+
+// Adds a tween, replacing the one of the same property
+NTAnimator::Id NTAnimator::insert(Tween tween)
+{
+	if (tween.id == 0) tween.id = _next++;
+	for (Tween &running : _tweens) {
+		if (running.object == tween.object && running.property == tween.property &&
+			(tween.property != NTT_COLOR || running.color == tween.color)) {
+			running = tween;
+			return tween.id;
+		}
+	}
+	auto it = std::upper_bound(_tweens.begin(), _tweens.end(), tween, [](const Tween &a, const Tween &b) {
+		return std::less<NTGraphicObject *>()(a.object, b.object);
+	});
+	_tweens.insert(it, tween);
+	return tween.id;
+}
+
+// Steps all tweens to a time
+size_t NTAnimator::advance(std::chrono::steady_clock::time_point now)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	size_t changed = 0;
+
+	// The tweens of a widget are neighbours: one lock and one change per widget
+	for (size_t first = 0; first < _tweens.size();) {
+		NTGraphicObject *object = _tweens[first].object;
+		size_t last = first;
+		while (last < _tweens.size() && _tweens[last].object == object) last++;
+
+		std::lock_guard<std::mutex> object_lock(object->_mutex);
+		bool moved = false, recolored = false;
+		for (size_t i = first; i < last; i++) {
+			Tween &tween = _tweens[i];
+			double t = 1.0;
+			if (tween.duration.count() > 0) {
+				t = std::chrono::duration<double>(now - tween.start) / std::chrono::duration<double>(tween.duration);
+				t = std::min(std::max(t, 0.0), 1.0);
+			}
+			double e = ease(tween.easing, t);
+
+			if (tween.property == NTT_COLOR) {
+				nt::Color color = {static_cast<unsigned char>(mix(tween.fromColor.red, tween.toColor.red, e)),
+								   static_cast<unsigned char>(mix(tween.fromColor.green, tween.toColor.green, e)),
+								   static_cast<unsigned char>(mix(tween.fromColor.blue, tween.toColor.blue, e))};
+				if (!same(color, tween.shown) || t >= 1.0) {
+					init_color(tween.color, color.red * 1000 / 255, color.green * 1000 / 255, color.blue * 1000 / 255);
+					recolored = recolored || !same(color, tween.shown);
+					tween.shown = color;
+				}
+			} else {
+				int &value = tween.property == NTT_X ? object->_x : object->_y;
+				int next = mix(tween.from, tween.to, e);
+				if (next != value) {
+					value = next;
+					moved = true;
+				}
+			}
+			if (t >= 1.0) tween.object = nullptr;	// finished
+		}
+
+		if (moved) object->placed();
+		if (moved || recolored) {
+			object->_changed = true;
+			changed++;
+		}
+		first = last;
+	}
+
+	_tweens.erase(std::remove_if(_tweens.begin(), _tweens.end(), [](const Tween &tween) { return !tween.object; }),
+				  _tweens.end());
+	return changed;
+}
@@ -0,0 +1,168 @@
+/*! \file       ntanimator.h
+ *  \brief      NT Animator module (header file).
+ *  \details    Contains the NTAnimator class definitions: tweens of the
+ *              position and the colors of widgets.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTANIMATOR_H_
+#define _NTANIMATOR_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Time durations */
+#include <chrono>
+/*! \brief  Fixed width integers */
+#include <cstdint>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+
+/* Animated properties */
+#define NTT_X		0	/*!< X coordinate */
+#define NTT_Y		1	/*!< Y coordinate */
+#define NTT_COLOR	2	/*!< Palette color used by the widget */
+
+/* Easing curves */
+#define NTE_LINEAR	0	/*!< Constant speed */
+#define NTE_IN		1	/*!< Starts slow (cubic) */
+#define NTE_OUT		2	/*!< Ends slow (cubic) */
+#define NTE_IN_OUT	3	/*!< Starts and ends slow (cubic) */
+
+/*! \class      NTAnimator
+ *  \brief      Tween engine.
+ *  \details    A tween moves a property of a widget from its current value
+ *              to a target value over a duration, along an easing curve.
+ *              advance() steps all tweens in one pass (NTFrameScheduler does
+ *              it once per frame): the tweens of a widget are applied under
+ *              one lock of the widget, which is marked changed once and only
+ *              if a value changed. A compositor damages the bounds of the
+ *              widget at the start and the end of the step, so a moving
+ *              widget costs two rectangles per frame, not a full redraw.
+ *
+ *              A color tween redefines a palette color with init_color()
+ *              (if the terminal can change colors), so all the cells of the
+ *              color follow it; the widget is marked changed to redraw them
+ *              on terminals and compositors that keep the cells.
+ *
+ *              A new tween of the same property of a widget replaces the old
+ *              one and starts from the current value. The animator does not
+ *              own the widgets: stop() the tweens of a widget before it is
+ *              destroyed. advance() must be called from the thread that
+ *              draws.
+ */
+class NTAnimator
+{
+public:
+	/*!	\brief	Tween handle (0 - none) */
+	typedef uint64_t Id;
+
+	/*! \brief  Constructor */
+	NTAnimator();
+
+	/*! \brief  Destructor */
+	~NTAnimator();
+
+	NTAnimator(const NTAnimator&) = delete;
+	NTAnimator& operator=(const NTAnimator&) = delete;
+
+	/*! \brief      Tweens a coordinate of a widget
+	 *  \param      object      Widget
+	 *  \param      property    NTT_X or NTT_Y
+	 *  \param      to          Target coordinate
+	 *  \param      duration    Duration of the tween
+	 *  \param      easing      NTE_LINEAR, NTE_IN, NTE_OUT or NTE_IN_OUT
+	 *  \return     Tween handle (0 if the property is not a coordinate)
+	 */
+	Id tween(NTGraphicObject *object, int property, int to, std::chrono::milliseconds duration, int easing = NTE_LINEAR);
+
+	/*! \brief      Tweens the position of a widget
+	 *  \details    Starts an NTT_X and an NTT_Y tween with one handle.
+	 *  \param      object      Widget
+	 *  \param      x           Target X coordinate
+	 *  \param      y           Target Y coordinate
+	 *  \param      duration    Duration of the tween
+	 *  \param      easing      NTE_LINEAR, NTE_IN, NTE_OUT or NTE_IN_OUT
+	 *  \return     Handle of both tweens
+	 */
+	Id move(NTGraphicObject *object, int x, int y, std::chrono::milliseconds duration, int easing = NTE_LINEAR);
+
+	/*! \brief      Tweens a palette color used by a widget
+	 *  \param      object      Widget drawn with the color
+	 *  \param      color       Color number (see init_color())
+	 *  \param      to          Target color
+	 *  \param      duration    Duration of the tween
+	 *  \param      easing      NTE_LINEAR, NTE_IN, NTE_OUT or NTE_IN_OUT
+	 *  \return     Tween handle
+	 */
+	Id fade(NTGraphicObject *object, short color, nt::Color to, std::chrono::milliseconds duration, int easing = NTE_LINEAR);
+
+	/*! \brief      Cancels a tween (the property keeps its current value)
+	 *  \param      id  Tween handle (both tweens of a move())
+	 *  \return     true if a tween was running
+	 */
+	bool cancel(Id id);
+
+	/*! \brief      Cancels all the tweens of a widget
+	 *  \param      object  Widget
+	 */
+	void stop(NTGraphicObject *object);
+
+	/*! \brief      Checks if a tween is running
+	 *  \param      id  Tween handle
+	 *  \return     true if running (either tween of a move())
+	 */
+	bool active(Id id) const;
+
+	/*! \brief      Gets the number of running tweens
+	 *  \return     Number of tweens
+	 */
+	size_t size() const;
+
+	/*! \brief      Steps all tweens to a time
+	 *  \details    Finished tweens set their target value and are removed.
+	 *  \param      now     Current time
+	 *  \return     Number of widgets changed
+	 */
+	size_t advance(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+private:
+	/*!	\brief	Running tween */
+	struct Tween {
+		Id id;									/*!< Handle */
+		NTGraphicObject *object;				/*!< Widget */
+		int property;							/*!< NTT_X, NTT_Y or NTT_COLOR */
+		int easing;								/*!< Easing curve */
+		int from;								/*!< Start coordinate */
+		int to;									/*!< Target coordinate */
+		short color;							/*!< Color number */
+		nt::Color fromColor;					/*!< Start color */
+		nt::Color toColor;						/*!< Target color */
+		nt::Color shown;						/*!< Color set by the last step */
+		std::chrono::steady_clock::time_point start;	/*!< Start time */
+		std::chrono::steady_clock::duration duration;	/*!< Duration */
+	};
+
+	/*! \brief      Adds a tween, replacing the one of the same property
+	 *  \details    Must be called with _mutex held. Keeps the tweens of a
+	 *              widget next to each other.
+	 *  \param      tween   Tween (handle 0 - a new one)
+	 *  \return     Tween handle
+	 */
+	Id insert(Tween tween);
+
+	mutable std::mutex _mutex;		/*!< Guards the tweens */
+	std::vector<Tween> _tweens;		/*!< Running tweens sorted by widget */
+	Id _next;						/*!< Handle of the next tween */
+};
+
+#endif // _NTANIMATOR_H_
@@ -0,0 +1,348 @@
+/*!	\file		ntassetpack.cpp
+ *	\brief		Implementation of the NTAssetPack and NTAssetPackWriter classes
+ *	\details	Contains method implementations for binary asset packs in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntassetpack.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Standard memory functions */
+#include <cstring>
+/*! \brief  C standard I/O */
+#include <cstdio>
+/*! \brief  Mutex library (for std::call_once) */
+#include <mutex>
+
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+namespace {
+	constexpr uint64_t PACK_ALIGN = 8;	/*!< Alignment of the data blocks */
+
+	// Rounds the offset up to the data alignment
+	uint64_t align(uint64_t offset)
+	{
+		return (offset + PACK_ALIGN - 1) & ~(PACK_ALIGN - 1);
+	}
+
+	// Checks that the host stores integers in the byte order of the pack
+	bool littleEndian()
+	{
+		const uint16_t probe = 1;
+		unsigned char first;
+		std::memcpy(&first, &probe, 1);
+		return first == 1;
+	}
+
+	// Compares the entry name with the key
+	int compareName(const nt::PackEntry &entry, const std::string &name)
+	{
+		return std::strncmp(entry.name, name.c_str(), nt::PACK_NAME_SIZE);
+	}
+
+	/*!	\brief	Frame view into the mapped pack */
+	class PackView : public NTImageSource
+	{
+	public:
+		PackView(std::shared_ptr<NTMappedFile> file, const nt::PackEntry &entry, unsigned int frame)
+			: _file(std::move(file)), _width(entry.width), _height(entry.height), _stride(entry.stride)
+		{
+			uint64_t rows = static_cast<uint64_t>(frame) * entry.height;
+			_rows = _file->data() + entry.dataOffset + rows * entry.stride;
+			_style = nullptr;
+			if (entry.flags & nt::ASSET_STYLE) {
+				_style = reinterpret_cast<const unsigned char *>(_file->data())
+						 + entry.styleOffset + rows * entry.width;
+			}
+		}
+
+		// Builds the column maps once
+		int load() override {
+			std::call_once(_once, [this] {
+				_layouts.resize(_height);
+				for (unsigned int y = 0; y < _height; y++) {
+					_layouts[y].assign(row(y));
+				}
+			});
+			return NT_OK;
+		}
+
+		unsigned int width() const override { return _width; }
+		unsigned int height() const override { return _height; }
+
+		std::string_view row(unsigned int y) const override {
+			const char *row = _rows + static_cast<size_t>(y) * _stride;
+			return std::string_view(row, strnlen(row, _stride));
+		}
+
+		const nt::TextLayout &layout(unsigned int y) const override { return _layouts[y]; }
+
+		const unsigned char *style(unsigned int y) const override {
+			return _style ? _style + static_cast<size_t>(y) * _width : nullptr;
+		}
+
+	private:
+		std::shared_ptr<NTMappedFile> _file;	/*!< Mapped pack */
+		const char *_rows;						/*!< First row of the frame */
+		const unsigned char *_style;			/*!< First style row of the frame */
+		unsigned int _width;					/*!< Frame width */
+		unsigned int _height;					/*!< Frame height */
+		unsigned int _stride;					/*!< Row size in bytes */
+		std::vector<nt::TextLayout> _layouts;	/*!< Column maps of the rows */
+		std::once_flag _once;					/*!< Guards the column maps */
+	};
+}
+
+// Computes the pack checksum
+uint32_t nt::packChecksum(const char *data, size_t size)
+{
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// Default constructor
+NTAssetPack::NTAssetPack() : _header(nullptr), _index(nullptr) {}
+
+// Constructor that opens the pack
+NTAssetPack::NTAssetPack(const std::string &path) : _header(nullptr), _index(nullptr)
+{
+	open(path);
+}
+
+// Destructor
+NTAssetPack::~NTAssetPack() = default;
+
+// Maps the pack and checks its index
+int NTAssetPack::open(const std::string &path)
+{
+	close();
+	if (!littleEndian()) return NT_ERR;
+
+	auto file = std::make_shared<NTMappedFile>();
+	if (file->open(path) != NT_OK) return NT_ERR;
+
+	// Check the header
+	uint64_t size = file->size();
+	if (size < sizeof(nt::PackHeader)) return NT_ERR;
+
+	const nt::PackHeader *header = reinterpret_cast<const nt::PackHeader *>(file->data());
+	if (std::memcmp(header->magic, nt::PACK_MAGIC, sizeof(header->magic)) != 0 ||
+		header->version != nt::PACK_VERSION || header->size != size) {
+		return NT_ERR;
+	}
+
+	// Check the index bounds
+	uint64_t index_size = static_cast<uint64_t>(header->count) * sizeof(nt::PackEntry);
+	if (header->indexOffset % PACK_ALIGN != 0 || header->indexOffset > size ||
+		index_size > size - header->indexOffset) {
+		return NT_ERR;
+	}
+
+	// Check the data bounds of every entry
+	const nt::PackEntry *index = reinterpret_cast<const nt::PackEntry *>(file->data() + header->indexOffset);
+	for (uint32_t i = 0; i < header->count; i++) {
+		const nt::PackEntry &entry = index[i];
+		if (entry.name[nt::PACK_NAME_SIZE - 1] != '\0') return NT_ERR;
+
+		// Divided instead of multiplied: the sizes of a crafted entry may not fit in 64 bits
+		uint64_t rows = static_cast<uint64_t>(entry.frames) * entry.height;
+		if (entry.dataOffset > size || (entry.stride != 0 && rows > (size - entry.dataOffset) / entry.stride)) return NT_ERR;
+
+		if (entry.flags & nt::ASSET_STYLE) {
+			if (entry.styleOffset > size || (entry.width != 0 && rows > (size - entry.styleOffset) / entry.width)) return NT_ERR;
+		}
+	}
+
+	_file = file;
+	_header = header;
+	_index = index;
+	return NT_OK;
+}
+
+// Releases the pack
+void NTAssetPack::close()
+{
+	_file.reset();
+	_header = nullptr;
+	_index = nullptr;
+}
+
+// Checks if the pack is open
+bool NTAssetPack::isOpen() const
+{
+	return _file != nullptr;
+}
+
+// Verifies the checksum
+int NTAssetPack::verify() const
+{
+	if (!_file) return NT_ERR;
+	uint32_t checksum = nt::packChecksum(_file->data() + sizeof(nt::PackHeader),
+										 _file->size() - sizeof(nt::PackHeader));
+	return checksum == _header->checksum ? NT_OK : NT_ERR;
+}
+
+// Gets the number of assets
+size_t NTAssetPack::count() const
+{
+	return _header ? _header->count : 0;
+}
+
+// Gets the index entry
+const nt::PackEntry *NTAssetPack::entry(size_t index) const
+{
+	if (index >= count()) return nullptr;
+	return &_index[index];
+}
+
+// Finds the asset by name
+int NTAssetPack::find(const std::string &name) const
+{
+	const nt::PackEntry *begin = _index;
+	const nt::PackEntry *end = _index + count();
+	const nt::PackEntry *it = std::lower_bound(begin, end, name,
+		[](const nt::PackEntry &entry, const std::string &key) { return compareName(entry, key) < 0; });
+
+	if (it == end || compareName(*it, name) != 0) return -1;
+	return static_cast<int>(it - begin);
+}
+
+// Gets the frame view
+std::shared_ptr<NTImageSource> NTAssetPack::image(const std::string &name, unsigned int frame) const
+{
+	return view(find(name), frame);
+}
+
+// Gets the glyph view of a font
+std::shared_ptr<NTImageSource> NTAssetPack::glyph(const std::string &font, char32_t cp) const
+{
+	int index = find(font);
+	if (index < 0 || _index[index].kind != nt::ASSET_FONT || cp < _index[index].first) return nullptr;
+	return view(index, cp - _index[index].first);
+}
+
+// Gets the frame view of the entry
+std::shared_ptr<NTImageSource> NTAssetPack::view(int index, unsigned int frame) const
+{
+	if (index < 0 || static_cast<size_t>(index) >= count()) return nullptr;
+	if (frame >= _index[index].frames) return nullptr;
+	return std::make_shared<PackView>(_file, _index[index], frame);
+}
+
+// Adds an asset
+int NTAssetPackWriter::add(const std::string &name, uint16_t kind,
+						   const std::vector<nt::Image> &frames, char32_t first,
+						   const std::vector<std::vector<unsigned char>> &style)
+{
+	if (name.empty() || name.size() >= nt::PACK_NAME_SIZE || frames.empty()) return NT_ERR;
+	if (!style.empty() && style.size() != frames.size()) return NT_ERR;
+
+	for (const Asset &asset : _assets) {
+		if (name == asset.entry.name) return NT_ERR;
+	}
+
+	Asset asset;
+	std::memset(&asset.entry, 0, sizeof(asset.entry));
+	std::memcpy(asset.entry.name, name.data(), name.size());
+	asset.entry.kind = kind;
+	asset.entry.first = first;
+	asset.entry.frames = frames.size();
+
+	// Measure the frames: widest row in columns, longest row in bytes
+	nt::TextLayout layout;
+	for (const nt::Image &frame : frames) {
+		asset.entry.width = std::max(asset.entry.width, frame.width);
+		asset.entry.height = std::max<uint32_t>(asset.entry.height, frame.img.size());
+		for (const std::string &row : frame.img) {
+			layout.assign(row);
+			asset.entry.width = std::max(asset.entry.width, layout.columns);
+			asset.entry.stride = std::max<uint32_t>(asset.entry.stride, row.size());
+		}
+	}
+	asset.entry.stride = std::max<uint32_t>(asset.entry.stride, 1);
+
+	if (!style.empty()) {
+		size_t plane = static_cast<size_t>(asset.entry.width) * asset.entry.height;
+		for (const auto &frame_style : style) {
+			if (frame_style.size() != plane) return NT_ERR;
+		}
+		asset.entry.flags |= nt::ASSET_STYLE;
+	}
+
+	asset.frames = frames;
+	asset.style = style;
+	_assets.push_back(std::move(asset));
+	return NT_OK;
+}
+
+// Writes the pack
+int NTAssetPackWriter::write(const std::string &path) const
+{
+	if (!littleEndian()) return NT_ERR;
+
+	// Index is sorted by name for the binary search
+	std::vector<const Asset *> assets;
+	for (const Asset &asset : _assets) assets.push_back(&asset);
+	std::sort(assets.begin(), assets.end(), [](const Asset *a, const Asset *b) {
+		return std::strncmp(a->entry.name, b->entry.name, nt::PACK_NAME_SIZE) < 0;
+	});
+
+	// Lay out the file: header, index, data blocks
+	std::vector<nt::PackEntry> index;
+	uint64_t offset = align(sizeof(nt::PackHeader) + assets.size() * sizeof(nt::PackEntry));
+	for (const Asset *asset : assets) {
+		nt::PackEntry entry = asset->entry;
+		uint64_t rows = static_cast<uint64_t>(entry.frames) * entry.height;
+		entry.dataOffset = offset;
+		offset = align(offset + rows * entry.stride);
+		if (entry.flags & nt::ASSET_STYLE) {
+			entry.styleOffset = offset;
+			offset = align(offset + rows * entry.width);
+		}
+		index.push_back(entry);
+	}
+
+	std::vector<char> data(offset, '\0');
+	for (size_t i = 0; i < assets.size(); i++) {
+		const nt::PackEntry &entry = index[i];
+		char *rows = data.data() + entry.dataOffset;
+		for (const nt::Image &frame : assets[i]->frames) {
+			for (const std::string &row : frame.img) {
+				std::memcpy(rows, row.data(), row.size());
+				rows += entry.stride;
+			}
+			rows += static_cast<size_t>(entry.height - frame.img.size()) * entry.stride;
+		}
+		char *style = data.data() + entry.styleOffset;
+		for (const auto &frame_style : assets[i]->style) {
+			std::memcpy(style, frame_style.data(), frame_style.size());
+			style += frame_style.size();
+		}
+	}
+
+	std::memcpy(data.data() + sizeof(nt::PackHeader), index.data(), index.size() * sizeof(nt::PackEntry));
+
+	nt::PackHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, nt::PACK_MAGIC, sizeof(header.magic));
+	header.version = nt::PACK_VERSION;
+	header.count = index.size();
+	header.indexOffset = sizeof(nt::PackHeader);
+	header.size = data.size();
+	header.checksum = nt::packChecksum(data.data() + sizeof(header), data.size() - sizeof(header));
+	std::memcpy(data.data(), &header, sizeof(header));
+
+	FILE *file = std::fopen(path.c_str(), "wb");
+	if (!file) return NT_ERR;
+	size_t written = std::fwrite(data.data(), 1, data.size(), file);
+	int closed = std::fclose(file);
+	return (written == data.size() && closed == 0) ? NT_OK : NT_ERR;
+}
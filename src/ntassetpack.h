@@ -0,0 +1,218 @@
+/*! \file       ntassetpack.h
+ *  \brief      NT Asset pack module (header file).
+ *  \details    Contains the binary asset pack format and the NTAssetPack
+ *              (reader) and NTAssetPackWriter classes definitions.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTASSETPACK_H_
+#define _NTASSETPACK_H_
+
+/*! \brief  Standard integer types */
+#include <cstdint>
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Image source interface */
+#include "ntimagesource.h"
+/*! \brief  Read-only mapped file */
+#include "ntmappedfile.h"
+
+/*!
+ *  \namespace nt
+ *  \brief     Namespace containing core types for NT project
+ */
+namespace nt {
+	constexpr char PACK_MAGIC[4] = {'N', 'T', 'P', 'K'};	/*!< Pack file magic */
+	constexpr uint16_t PACK_VERSION = 1;					/*!< Pack format version */
+	constexpr size_t PACK_NAME_SIZE = 32;					/*!< Asset name field size (with terminating zero) */
+
+	constexpr uint16_t ASSET_IMAGE	= 0;	/*!< Single image */
+	constexpr uint16_t ASSET_FONT	= 1;	/*!< Glyph set indexed by code point */
+	constexpr uint16_t ASSET_SPRITE	= 2;	/*!< Animation frames */
+
+	constexpr uint16_t ASSET_STYLE	= (1 << 0);	/*!< Asset has a style plane */
+
+	/*!
+	 *  \struct PackHeader
+	 *  \brief    Asset pack file header
+	 *  \details  All fields are little-endian. The header and the index are
+	 *            read in place from the mapping, so packs are only opened and
+	 *            written on little-endian hosts. The checksum is FNV-1a (32 bit)
+	 *            of every byte after the header.
+	 */
+	struct PackHeader {
+		char magic[4];			/*!< PACK_MAGIC */
+		uint16_t version;		/*!< PACK_VERSION */
+		uint16_t reserved;		/*!< Zero */
+		uint32_t count;			/*!< Number of index entries */
+		uint32_t checksum;		/*!< FNV-1a of the rest of the file */
+		uint64_t indexOffset;	/*!< Offset of the index (sorted by name) */
+		uint64_t size;			/*!< Total file size */
+	};
+
+	/*!
+	 *  \struct PackEntry
+	 *  \brief    Asset pack index entry
+	 *  \details  Glyph data is frames * height rows of stride bytes, each row
+	 *            padded with zeros. The style plane (if any) is frames * height
+	 *            rows of width color pairs.
+	 */
+	struct PackEntry {
+		char name[PACK_NAME_SIZE];	/*!< Zero-terminated asset name */
+		uint16_t kind;				/*!< ASSET_IMAGE, ASSET_FONT or ASSET_SPRITE */
+		uint16_t flags;				/*!< ASSET_STYLE */
+		uint32_t first;				/*!< First code point of a font */
+		uint32_t frames;			/*!< Number of frames (glyphs) */
+		uint32_t width;				/*!< Frame width in columns */
+		uint32_t height;			/*!< Frame height in rows */
+		uint32_t stride;			/*!< Row size in bytes */
+		uint64_t dataOffset;		/*!< Offset of the glyph data */
+		uint64_t styleOffset;		/*!< Offset of the style plane (0 - none) */
+	};
+
+	static_assert(sizeof(PackHeader) == 32, "PackHeader layout");
+	static_assert(sizeof(PackEntry) == 72, "PackEntry layout");
+
+	/*!	\brief		Computes the pack checksum
+	 *	\param		data	Pointer to the data
+	 *	\param		size	Size of the data
+	 *	\return		FNV-1a (32 bit) hash
+	 */
+	uint32_t packChecksum(const char *data, size_t size);
+
+} // namespace nt
+
+/*! \class      NTAssetPack
+ *  \brief      Read-only asset pack.
+ *  \details    The pack is mapped read-only and shared, so several processes
+ *              using the same pack share its pages. Open checks the header
+ *              and the index bounds only; frames are returned as views into
+ *              the mapping and nothing is decoded until an image is drawn.
+ */
+class NTAssetPack
+{
+public:
+	/*! \brief  Default constructor */
+	NTAssetPack();
+
+	/*! \brief      Constructor that opens the pack
+	 *  \param      path    Path to the pack file
+	 */
+	explicit NTAssetPack(const std::string &path);
+
+	/*! \brief  Destructor */
+	~NTAssetPack();
+
+	NTAssetPack(const NTAssetPack&) = delete;
+	NTAssetPack& operator=(const NTAssetPack&) = delete;
+
+	/*! \brief      Maps the pack and checks its index
+	 *  \param      path    Path to the pack file
+	 *  \return     NT_OK if success, NT_ERR if the file is missing or malformed
+	 *              or the host is big-endian
+	 */
+	int open(const std::string &path);
+
+	/*! \brief  Releases the pack (views in use keep the mapping) */
+	void close();
+
+	/*! \brief      Checks if the pack is open
+	 *  \return     true if open, false otherwise
+	 */
+	bool isOpen() const;
+
+	/*! \brief      Verifies the checksum
+	 *  \details    Reads the whole pack, so it is not done by open().
+	 *  \return     NT_OK if the checksum matches, NT_ERR otherwise
+	 */
+	int verify() const;
+
+	/*! \brief      Gets the number of assets
+	 *  \return     Number of index entries
+	 */
+	size_t count() const;
+
+	/*! \brief      Gets the index entry
+	 *  \param      index   Entry index
+	 *  \return     Pointer into the mapping or nullptr if the index is out of range
+	 */
+	const nt::PackEntry *entry(size_t index) const;
+
+	/*! \brief      Finds the asset by name
+	 *  \param      name    Asset name
+	 *  \return     Entry index or -1 if not found
+	 */
+	int find(const std::string &name) const;
+
+	/*! \brief      Gets the frame view
+	 *  \param      name    Asset name
+	 *  \param      frame   Frame index
+	 *  \return     Image source or nullptr if not found
+	 */
+	std::shared_ptr<NTImageSource> image(const std::string &name, unsigned int frame = 0) const;
+
+	/*! \brief      Gets the glyph view of a font
+	 *  \param      font    Font asset name
+	 *  \param      cp      Code point
+	 *  \return     Image source or nullptr if the font has no such glyph
+	 */
+	std::shared_ptr<NTImageSource> glyph(const std::string &font, char32_t cp) const;
+
+private:
+	/*! \brief      Gets the frame view of the entry
+	 *  \param      index   Entry index
+	 *  \param      frame   Frame index
+	 *  \return     Image source or nullptr if out of range
+	 */
+	std::shared_ptr<NTImageSource> view(int index, unsigned int frame) const;
+
+	std::shared_ptr<NTMappedFile> _file;	/*!< Mapped pack */
+	const nt::PackHeader *_header;			/*!< Header in the mapping */
+	const nt::PackEntry *_index;			/*!< Index in the mapping */
+};
+
+/*! \class      NTAssetPackWriter
+ *  \brief      Asset pack builder.
+ */
+class NTAssetPackWriter
+{
+public:
+	/*! \brief      Adds an asset
+	 *  \param      name    Asset name (up to PACK_NAME_SIZE - 1 bytes, unique)
+	 *  \param      kind    ASSET_IMAGE, ASSET_FONT or ASSET_SPRITE
+	 *  \param      frames  Frames (glyphs) of the asset
+	 *  \param      first   First code point (fonts only)
+	 *  \param      style   Style planes, one per frame of width * height color pairs (optional)
+	 *  \return     NT_OK if success, NT_ERR if the asset can not be added
+	 */
+	int add(const std::string &name, uint16_t kind,
+			const std::vector<nt::Image> &frames, char32_t first = 0,
+			const std::vector<std::vector<unsigned char>> &style = {});
+
+	/*! \brief      Writes the pack
+	 *  \param      path    Path to the pack file
+	 *  \return     NT_OK if success, NT_ERR otherwise (also on big-endian hosts)
+	 */
+	int write(const std::string &path) const;
+
+private:
+	/*!	\brief	Asset to be written */
+	struct Asset {
+		nt::PackEntry entry;						/*!< Index entry (offsets set on write) */
+		std::vector<nt::Image> frames;				/*!< Frames */
+		std::vector<std::vector<unsigned char>> style;	/*!< Style planes */
+	};
+
+	std::vector<Asset> _assets;		/*!< Assets to be written */
+};
+
+#endif // _NTASSETPACK_H_
@@ -0,0 +1,422 @@
+/*!	\file		ntcellstore.cpp
+ *	\brief		Implementation of thread-safe NTCellStore class
+ *	\details	Contains method implementations for structure-of-arrays cell stores in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntcellstore.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Numeric limits */
+#include <climits>
+
+// Cell handle constructor
+NTCellStore::Cell::Cell(NTCellStore *store, unsigned int index) : _store(store), _index(index) {}
+
+// Set X coordinate position
+void NTCellStore::Cell::setx(int x)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_xs[_index] = x;
+	_store->extend(_index);
+}
+
+// Get X coordinate position
+int NTCellStore::Cell::x() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_xs[_index];
+}
+
+// Set Y coordinate position
+void NTCellStore::Cell::sety(int y)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_ys[_index] = y;
+	_store->extend(_index);
+}
+
+// Get Y coordinate position
+int NTCellStore::Cell::y() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_ys[_index];
+}
+
+// Set X, Y coordinate position
+void NTCellStore::Cell::setPosition(int x, int y)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_xs[_index] = x;
+	_store->_ys[_index] = y;
+	_store->extend(_index);
+}
+
+// Set color pair
+void NTCellStore::Cell::setColorPair(unsigned char colorPair)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_colorPairs[_index] = colorPair;
+	_store->touch(_index);
+}
+
+// Get color pair
+unsigned char NTCellStore::Cell::colorPair() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_colorPairs[_index];
+}
+
+// Set ncurses attr
+void NTCellStore::Cell::setAttr(chtype attr)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_attrs[_index] = attr;
+	_store->touch(_index);
+}
+
+// Get ncurses attr
+chtype NTCellStore::Cell::attr() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_attrs[_index];
+}
+
+// Set nt attr
+void NTCellStore::Cell::setNtattr(unsigned char ntattr)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	_store->_ntattrs[_index] = ntattr;
+	_store->touch(_index);
+}
+
+// Get nt attr
+unsigned char NTCellStore::Cell::ntattr() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_ntattrs[_index];
+}
+
+// Sets the text data
+void NTCellStore::Cell::setText(std::string_view text)
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	NTCellStore &store = *_store;
+	if (store.textOf(_index) == text) return;
+
+	// Reuse the slot of the cell if the text fits, otherwise move it to the end
+	if (text.size() > store._capacities[_index]) {
+		store._garbage += store._capacities[_index];
+		store._offsets[_index] = store._text.size();
+		store._capacities[_index] = text.size();
+		store._text.append(text);
+	} else {
+		store._text.replace(store._offsets[_index], text.size(), text);
+	}
+	store._lengths[_index] = text.size();
+	store._layouts[_index].assign(text);
+
+	if (store._garbage > store._text.size() / 2) {
+		store.compact();
+	}
+	store.extend(_index);
+}
+
+// Gets the text data
+std::string NTCellStore::Cell::text() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return std::string(_store->textOf(_index));
+}
+
+// Gets the cell changed flag
+bool NTCellStore::Cell::isChanged() const
+{
+	std::lock_guard<std::mutex> lock(_store->_mutex);
+	return _store->_dirty[_index] != 0;
+}
+
+// Gets the cell index
+unsigned int NTCellStore::Cell::index() const
+{
+	return _index;
+}
+
+// Default constructor
+NTCellStore::NTCellStore(NTObject *parent, const std::string &name)
+	: NTCellStore(parent, name, 0, 0)
+{
+}
+
+// Parameterized constructor
+NTCellStore::NTCellStore(NTObject *parent, const std::string &name, int x, int y)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the cell origin
+	0,								// Color pair (cells have their own)
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_garbage(0),
+	_drawn(false), _drawnX(0), _drawnY(0),
+	_extent({0, 0, 0, 0})
+{
+}
+
+// Destructor
+NTCellStore::~NTCellStore() = default;
+
+// Reserves memory for cells
+void NTCellStore::reserve(size_t cells, size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_xs.reserve(cells);
+	_ys.reserve(cells);
+	_colorPairs.reserve(cells);
+	_attrs.reserve(cells);
+	_ntattrs.reserve(cells);
+	_offsets.reserve(cells);
+	_lengths.reserve(cells);
+	_capacities.reserve(cells);
+	_layouts.reserve(cells);
+	_drawnXs.reserve(cells);
+	_drawnYs.reserve(cells);
+	_drawnColumns.reserve(cells);
+	_dirty.reserve(cells);
+	_batch.reserve(cells);
+	_text.reserve(bytes);
+}
+
+// Adds a cell
+NTCellStore::Cell NTCellStore::add(int x, int y, std::string_view text,
+								   unsigned char colorPair, chtype attr, unsigned char ntattr)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	unsigned int index = _xs.size();
+	_xs.push_back(x);
+	_ys.push_back(y);
+	_colorPairs.push_back(colorPair);
+	_attrs.push_back(attr);
+	_ntattrs.push_back(ntattr);
+	_offsets.push_back(_text.size());
+	_lengths.push_back(text.size());
+	_capacities.push_back(text.size());
+	_text.append(text);
+	_layouts.emplace_back();
+	_layouts.back().assign(text);
+	_drawnXs.push_back(0);
+	_drawnYs.push_back(0);
+	_drawnColumns.push_back(0);
+	_dirty.push_back(1);
+	extend(index);
+	return Cell(this, index);
+}
+
+// Gets the handle of a cell
+NTCellStore::Cell NTCellStore::cell(unsigned int index)
+{
+	return Cell(this, index);
+}
+
+// Gets the number of cells
+size_t NTCellStore::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _xs.size();
+}
+
+// Removes all cells
+void NTCellStore::clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_xs.clear();
+	_ys.clear();
+	_colorPairs.clear();
+	_attrs.clear();
+	_ntattrs.clear();
+	_offsets.clear();
+	_lengths.clear();
+	_capacities.clear();
+	_layouts.clear();
+	_drawnXs.clear();
+	_drawnYs.clear();
+	_drawnColumns.clear();
+	_dirty.clear();
+	_text.clear();
+	_garbage = 0;
+	_extent = {0, 0, 0, 0};
+	_changed = true;
+	placed();
+}
+
+// Gets the area covered by the cells
+nt::Rect NTCellStore::area() const
+{
+	return {_x + _extent.x, _y + _extent.y, _extent.width, _extent.height};
+}
+
+// Gets the area of the changed cells
+nt::Rect NTCellStore::dirtyArea() const
+{
+	if (!_drawn || _drawnX != _x || _drawnY != _y) return area();
+
+	// New cells of the changed cells and the cells they were drawn on
+	int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+	for (size_t i = 0; i < _dirty.size(); i++) {
+		if (!_dirty[i]) continue;
+		x0 = std::min(x0, _x + _xs[i]);
+		y0 = std::min(y0, _y + _ys[i]);
+		x1 = std::max(x1, _x + _xs[i] + static_cast<int>(_layouts[i].columns));
+		y1 = std::max(y1, _y + _ys[i] + 1);
+		if (_drawnColumns[i] == 0) continue;
+		x0 = std::min(x0, _drawnXs[i]);
+		y0 = std::min(y0, _drawnYs[i]);
+		x1 = std::max(x1, _drawnXs[i] + static_cast<int>(_drawnColumns[i]));
+		y1 = std::max(y1, _drawnYs[i] + 1);
+	}
+	if (x0 > x1) return {_x, _y, 0, 0};
+	return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// Forces a redraw of all cells on the next draw()
+void NTCellStore::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_drawn = false;
+	_changed = true;
+}
+
+// Marks the cell changed and grows the area to cover it
+void NTCellStore::extend(unsigned int index)
+{
+	touch(index);
+
+	int width = static_cast<int>(_layouts[index].columns);
+	if (width == 0) return;
+
+	nt::Rect cell = {_xs[index], _ys[index], width, 1};
+	if (_extent.width == 0) {
+		_extent = cell;
+	} else {
+		int right = std::max(_extent.x + _extent.width, cell.x + cell.width);
+		int bottom = std::max(_extent.y + _extent.height, cell.y + 1);
+		_extent.x = std::min(_extent.x, cell.x);
+		_extent.y = std::min(_extent.y, cell.y);
+		_extent.width = right - _extent.x;
+		_extent.height = bottom - _extent.y;
+	}
+	placed();
+}
+
+// Marks the cell changed
+void NTCellStore::touch(unsigned int index)
+{
+	_dirty[index] = 1;
+	_changed = true;
+}
+
+// Gets the text of the cell
+std::string_view NTCellStore::textOf(unsigned int index) const
+{
+	return std::string_view(_text).substr(_offsets[index], _lengths[index]);
+}
+
+// Erases the cells a cell was drawn on
+void NTCellStore::erase(unsigned int index, int first, int max_x, int max_y)
+{
+	int y = _drawnYs[index];
+	if (y < 0 || y >= max_y) return;
+	for (int col = first; col < static_cast<int>(_drawnColumns[index]); col++) {
+		int x = _drawnXs[index] + col;
+		if (x < 0 || x >= max_x) continue;
+		if (_occlusion && !_occlusion->visible(x, y, _depth)) continue;
+		clearCell(y, x);
+	}
+}
+
+// Packs the text of all cells to the start of the buffer
+void NTCellStore::compact()
+{
+	std::string text;
+	text.reserve(_text.size() - _garbage);
+	for (size_t i = 0; i < _offsets.size(); i++) {
+		std::string_view old = textOf(i);
+		_offsets[i] = text.size();
+		_capacities[i] = old.size();
+		text.append(old);
+	}
+	_text.swap(text);
+	_garbage = 0;
+}
+
+// Draws the changed cells
+int NTCellStore::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Moving the store redraws every cell. So does a screen: it cleared all of
+	// dirtyArea(), and the occlusion map clips the cells to what it cleared
+	bool all = _occlusion || !_drawn || _drawnX != _x || _drawnY != _y;
+
+	// Erase what the changed cells left: all of a moved cell, the tail of a shorter one
+	size_t count = _xs.size();
+	for (size_t i = 0; i < count; i++) {
+		if ((!all && !_dirty[i]) || _drawnColumns[i] == 0) continue;
+		bool moved = _drawnXs[i] != _x + _xs[i] || _drawnYs[i] != _y + _ys[i];
+		erase(i, moved ? 0 : static_cast<int>(_layouts[i].columns), max_x, max_y);
+		_drawnColumns[i] = 0;
+	}
+
+	// Cull: collect the changed cells that touch the screen
+	_batch.clear();
+	for (size_t i = 0; i < count; i++) {
+		if (!all && !_dirty[i]) continue;
+		int y = _y + _ys[i];
+		int x = _x + _xs[i];
+		int columns = static_cast<int>(_layouts[i].columns);
+		if (y >= 0 && y < max_y && x < max_x && x + columns > 0) {
+			_batch.push_back(i);
+		}
+	}
+
+	// Rasterize: the style of the store is the style of the cell being drawn
+	unsigned char colorPair = _colorPair;
+	chtype attr = _attr;
+	unsigned char ntattr = _ntattr;
+	for (unsigned int i : _batch) {
+		int y = _y + _ys[i];
+		int x = _x + _xs[i];
+		_colorPair = _colorPairs[i];
+		_attr = _attrs[i];
+		_ntattr = _ntattrs[i];
+
+		if (drawText(y, x, textOf(i), _layouts[i], max_x) == ERR) result = ERR;
+		_drawnXs[i] = x;
+		_drawnYs[i] = y;
+		_drawnColumns[i] = _layouts[i].columns;
+	}
+	_colorPair = colorPair;
+	_attr = attr;
+	_ntattr = ntattr;
+
+	std::fill(_dirty.begin(), _dirty.end(), 0);
+	_drawn = true;
+	_drawnX = _x;
+	_drawnY = _y;
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
@@ -0,0 +1,272 @@
+/*! \file       ntcellstore.h
+ *  \brief      NT Cell store module (header file).
+ *  \details    Contains the NTCellStore class definitions: many simple text
+ *              cells kept in parallel arrays and drawn as one widget.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTCELLSTORE_H_
+#define _NTCELLSTORE_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard string view */
+#include <string_view>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+/*! \class      NTCellStore
+ *  \brief      Structure-of-arrays store of text cells.
+ *  \details    Keeps positions, styles, text spans and dirty flags of all
+ *              cells in parallel arrays and the text of all cells in one
+ *              buffer. The store is one widget with one mutex; cells are
+ *              addressed by light Cell handles with the property set of
+ *              NTGraphicObject. draw() culls and rasterizes only the dirty
+ *              cells in one pass. Cell positions are relative to the position
+ *              of the store; moving the store redraws all cells. A cell that
+ *              moves or gets shorter erases the cells it was drawn on.
+ *  \extends    NTGraphicObject
+ */
+class NTCellStore : public NTGraphicObject
+{
+public:
+	/*! \class      Cell
+	 *  \brief      Handle of one cell.
+	 *  \details    Two words, cheap to copy. Valid until the store is cleared.
+	 */
+	class Cell
+	{
+	public:
+		/*! \brief      Sets the X coordinate
+		 *  \param      x   New X coordinate value
+		 */
+		void setx(int x);
+
+		/*! \brief      Gets the X coordinate
+		 *  \return     Current X coordinate value
+		 */
+		int x() const;
+
+		/*! \brief      Sets the Y coordinate
+		 *  \param      y   New Y coordinate value
+		 */
+		void sety(int y);
+
+		/*! \brief      Gets the Y coordinate
+		 *  \return     Current Y coordinate value
+		 */
+		int y() const;
+
+		/*! \brief      Sets the X, Y coordinate
+		 *  \param[in]	x   New X coordinate value
+		 *	\param[in]	y   New Y coordinate value
+		 */
+		void setPosition(int x, int y);
+
+		/*! \brief      Sets the color pair
+		 *  \param      colorPair   New color pair value
+		 */
+		void setColorPair(unsigned char colorPair);
+
+		/*! \brief      Gets the color pair
+		 *  \return     Current color pair value
+		 */
+		unsigned char colorPair() const;
+
+		/*! \brief      Sets the ncurses attr
+		 *  \param      attr New ncurses attr value
+		 */
+		void setAttr(chtype attr);
+
+		/*! \brief      Gets the ncurses attr
+		 *  \return     ncurses attr value
+		 */
+		chtype attr() const;
+
+		/*! \brief      Sets the nt attr
+		 *  \param      ntattr New nt attr value
+		 */
+		void setNtattr(unsigned char ntattr);
+
+		/*! \brief      Gets the nt attr
+		 *  \return     nt attr value
+		 */
+		unsigned char ntattr() const;
+
+		/*! \brief      Sets the text data
+		 *  \param      text   New UTF-8 text
+		 */
+		void setText(std::string_view text);
+
+		/*! \brief      Gets the text data
+		 *  \return     Current text
+		 */
+		std::string text() const;
+
+		/*! \brief      Gets the cell changed flag
+		 *  \return     true if changed since the last draw, false otherwise
+		 */
+		bool isChanged() const;
+
+		/*! \brief      Gets the cell index
+		 *  \return     Index in the store
+		 */
+		unsigned int index() const;
+
+	private:
+		friend class NTCellStore;
+
+		Cell(NTCellStore *store, unsigned int index);
+
+		NTCellStore *_store;	/*!< Store of the cell */
+		unsigned int _index;	/*!< Index in the store */
+	};
+
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    Store name (default: empty string)
+	 */
+	NTCellStore(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent  Pointer to the parent object
+	 *  \param      name    Store name
+	 *  \param      x       X coordinate of the cell origin
+	 *  \param      y       Y coordinate of the cell origin
+	 */
+	NTCellStore(NTObject *parent, const std::string &name, int x, int y);
+
+	/*! \brief  Destructor */
+	~NTCellStore();
+
+	NTCellStore(const NTCellStore&) = delete;
+	NTCellStore& operator=(const NTCellStore&) = delete;
+
+	/*! \brief      Reserves memory for cells
+	 *  \param      cells   Number of cells
+	 *  \param      bytes   Text bytes of all cells
+	 */
+	void reserve(size_t cells, size_t bytes = 0);
+
+	/*! \brief      Adds a cell
+	 *  \param      x           X coordinate relative to the store
+	 *  \param      y           Y coordinate relative to the store
+	 *  \param      text        UTF-8 text
+	 *  \param      colorPair   Color pair to draw from the palette
+	 *  \param      attr        Attr of the cell
+	 *  \param      ntattr      nt attr of the cell
+	 *  \return     Handle of the new cell
+	 */
+	Cell add(int x, int y, std::string_view text,
+			 unsigned char colorPair = 0, chtype attr = A_NORMAL, unsigned char ntattr = NTA_NONE);
+
+	/*! \brief      Gets the handle of a cell
+	 *  \param      index   Cell index (not checked)
+	 *  \return     Handle of the cell
+	 */
+	Cell cell(unsigned int index);
+
+	/*! \brief      Gets the number of cells
+	 *  \return     Number of cells
+	 */
+	size_t size() const;
+
+	/*! \brief  Removes all cells (handles become invalid) */
+	void clear();
+
+	/*! \brief      Forces a redraw of all cells on the next draw() */
+	void invalidate() override;
+
+	/*! \brief     Draws the changed cells
+	 *  \return    OK if success,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the cells
+	 *  \details    Must be called with _mutex held. The area only grows
+	 *              until clear(), so moving cells is cheap.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Gets the area of the changed cells
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect dirtyArea() const override;
+
+private:
+	/*! \brief      Marks the cell changed and grows the area to cover it
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Cell index
+	 */
+	void extend(unsigned int index);
+
+	/*! \brief      Marks the cell changed
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Cell index
+	 */
+	void touch(unsigned int index);
+
+	/*! \brief      Gets the text of the cell
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Cell index
+	 *  \return     UTF-8 bytes of the text
+	 */
+	std::string_view textOf(unsigned int index) const;
+
+	/*! \brief      Erases the cells a cell was drawn on
+	 *  \details    Must be called with _mutex held. The cells become empty
+	 *              spaces even if the cell has transparent spaces; cells
+	 *              hidden by the objects above are kept.
+	 *  \param      index   Cell index
+	 *  \param      first   First drawn column to erase
+	 *  \param      max_x   Terminal width
+	 *  \param      max_y   Terminal height
+	 */
+	void erase(unsigned int index, int first, int max_x, int max_y);
+
+	/*! \brief      Packs the text of all cells to the start of the buffer
+	 *  \details    Must be called with _mutex held.
+	 */
+	void compact();
+
+	/* Cell properties, one entry per cell */
+	std::vector<int> _xs;						/*!< X coordinates */
+	std::vector<int> _ys;						/*!< Y coordinates */
+	std::vector<unsigned char> _colorPairs;		/*!< Color pairs */
+	std::vector<chtype> _attrs;					/*!< ncurses attrs */
+	std::vector<unsigned char> _ntattrs;		/*!< nt attrs */
+	std::vector<unsigned int> _offsets;			/*!< Text offsets in the buffer */
+	std::vector<unsigned int> _lengths;			/*!< Text lengths in bytes */
+	std::vector<unsigned int> _capacities;		/*!< Bytes reserved for the text in the buffer */
+	std::vector<nt::TextLayout> _layouts;		/*!< Column maps of the text */
+	std::vector<int> _drawnXs;					/*!< Screen X coordinates of the last draw */
+	std::vector<int> _drawnYs;					/*!< Screen Y coordinates of the last draw */
+	std::vector<unsigned int> _drawnColumns;	/*!< Columns on the screen after the last draw (0 - not drawn) */
+	std::vector<unsigned char> _dirty;			/*!< Changed flags */
+
+	std::string _text;					/*!< Text of all cells */
+	size_t _garbage;					/*!< Bytes of the buffer no cell uses */
+	std::vector<unsigned int> _batch;	/*!< Cells to draw (kept to reuse the memory) */
+	bool _drawn;						/*!< Cells are on the screen */
+	int _drawnX;						/*!< X coordinate of the origin on the screen */
+	int _drawnY;						/*!< Y coordinate of the origin on the screen */
+	nt::Rect _extent;					/*!< Area of the cells relative to the origin */
+};
+
+#endif // _NTCELLSTORE_H_
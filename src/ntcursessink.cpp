@@ -0,0 +1,151 @@
+/*!	\file		ntcursessink.cpp
+ *	\brief		Implementation of the NTCursesSink class
+ *	\details	Contains method implementations for frame output to ncurses in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntcursessink.h"
+
+/*! \brief  Descriptor polling */
+#include <poll.h>
+/*! \brief  Terminal output queue (TIOCOUTQ) */
+#include <sys/ioctl.h>
+
+// Constructor
+NTCursesSink::NTCursesSink(WINDOW *window, SCREEN *screen, int fd)
+	: _window(window), _screen(screen), _fd(fd), _written(0) {}
+
+// Destructor
+NTCursesSink::~NTCursesSink() = default;
+
+// Writes the changes of a frame
+int NTCursesSink::present(const NTFrameBuffer &frame)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// Slow terminal: skip the frame, the window keeps what it shows
+	if (!ready()) {
+		_written = 0;
+		return NT_OK;
+	}
+
+	SCREEN *previous = enter();
+	WINDOW *window = _window ? _window : stdscr;
+	int result = NT_OK;
+
+	// New window size: nothing on the window is known
+	int max_y, max_x;
+	getmaxyx(window, max_y, max_x);
+	const nt::Rect &area = _front.area();
+	if (area.width != max_x || area.height != max_y) _front.reset({0, 0, max_x, max_y}, NTFrameBuffer::empty());
+
+	// Cells that differ from the window
+	nt::Size size = {max_x, max_y};
+	_changes.clear();
+	for (int y = 0; y < max_y; y++) {
+		NTFrameBuffer::Cell *shown = _front.at(0, y);
+		for (int x = 0; x < max_x; x++, shown++) {
+			NTFrameBuffer::Cell cell = frame.shown(x, y, size);
+			if (NTFrameBuffer::same(cell, *shown)) continue;
+			*shown = cell;
+			if (cell.flags & NTF_CONTINUATION) continue;	// written with the left half
+			_changes.push_back(static_cast<size_t>(y) * max_x + x);
+		}
+	}
+	if (previous && previous != _screen) copyPairs(previous);
+
+	const NTFrameBuffer::Cell *cells = _front.at(0, 0);
+	for (size_t index : _changes) {
+		int x = static_cast<int>(index % max_x), y = static_cast<int>(index / max_x);
+		cchar_t output;
+		setcchar(&output, cells[index].text, cells[index].attr, cells[index].pair, nullptr);
+		if (mvwadd_wch(window, y, x, &output) == ERR && !(y == max_y - 1 && x >= max_x - 2)) result = NT_ERR;	// the last cell cannot scroll
+	}
+	_written = _changes.size();
+	if (_written > 0) wrefresh(window);
+	leave(previous);
+	return result;
+}
+
+// Writes the whole next frame
+void NTCursesSink::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_front.reset(_front.area(), NTFrameBuffer::empty());
+}
+
+// Gets the number of cells written by the last present()
+size_t NTCursesSink::written() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _written;
+}
+
+// Defines a color pair of the terminal
+void NTCursesSink::define(short pair, short foreground, short background)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (pair <= 0) return;
+	SCREEN *previous = enter();
+	if (has_colors() && pair < COLOR_PAIRS) init_pair(pair, foreground, background);
+	if (static_cast<size_t>(pair) >= _pairs.size()) _pairs.resize(static_cast<size_t>(pair) + 1, 0);
+	_pairs[pair] = 1;
+	leave(previous);
+}
+
+// Checks if the terminal took the output of the last frame
+bool NTCursesSink::ready() const
+{
+	if (_fd < 0) return true;
+
+	pollfd output = {_fd, POLLOUT, 0};
+	if (poll(&output, 1, 0) <= 0 || !(output.revents & POLLOUT)) return false;
+
+	// A tty takes writes while its queue is not full: wait until it is empty
+	int queued = 0;
+	return ioctl(_fd, TIOCOUTQ, &queued) != 0 || queued == 0;
+}
+
+// Makes the terminal of the sink current
+SCREEN *NTCursesSink::enter()
+{
+	return _screen ? set_term(_screen) : nullptr;
+}
+
+// Makes the previous terminal current again
+void NTCursesSink::leave(SCREEN *previous)
+{
+	if (previous && previous != _screen) set_term(previous);
+}
+
+// Copies the color pairs of the changed cells to the terminal
+void NTCursesSink::copyPairs(SCREEN *source)
+{
+	// Pairs shown for the first time
+	std::vector<short> pairs;
+	const NTFrameBuffer::Cell *cells = _front.at(0, 0);
+	for (size_t index : _changes) {
+		short pair = cells[index].pair;
+		if (pair <= 0) continue;
+		if (static_cast<size_t>(pair) >= _pairs.size()) _pairs.resize(static_cast<size_t>(pair) + 1, 0);
+		if (_pairs[pair]) continue;
+		_pairs[pair] = 1;
+		pairs.push_back(pair);
+	}
+	if (pairs.empty()) return;
+
+	// Their colors on the terminal that drew them
+	std::vector<std::pair<short, short>> colors(pairs.size(), {-1, -1});
+	set_term(source);
+	for (size_t i = 0; i < pairs.size(); i++) {
+		if (pair_content(pairs[i], &colors[i].first, &colors[i].second) == ERR) colors[i] = {-1, -1};
+	}
+	set_term(_screen);
+
+	if (!has_colors()) return;
+	for (size_t i = 0; i < pairs.size(); i++) {
+		if (pairs[i] < COLOR_PAIRS) init_pair(pairs[i], colors[i].first, colors[i].second);
+	}
+}
@@ -0,0 +1,119 @@
+/*! \file       ntcursessink.h
+ *  \brief      NT Curses sink module (header file).
+ *  \details    Contains the NTCursesSink class definitions: frame output to
+ *              an ncurses window.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTCURSESSINK_H_
+#define _NTCURSESSINK_H_
+
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Standard vector library */
+#include <vector>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+
+/*! \class      NTCursesSink
+ *  \brief      Frame output to an ncurses window.
+ *  \details    Writes the cells that differ from the frame on the window
+ *              and refreshes it if any was written. The window shows the
+ *              part of the frame that fits in it. A sink of another
+ *              terminal (see newterm()) makes its terminal current while
+ *              writing and makes the previous one current again, so one
+ *              program can mirror its frames to several terminals. Color
+ *              pairs the sink terminal does not know yet are copied from
+ *              the terminal that was current when they are first shown.
+ *              ncurses must only be called from one thread.
+ *
+ *              Given the descriptor its terminal writes to, the sink does not
+ *              hold up present() on a slow terminal: while the output of a
+ *              frame is still queued, the next frames are not written, and
+ *              the first one after it carries all their changes.
+ */
+class NTCursesSink : public NTFrameSink
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      window  Window (nullptr - stdscr of the terminal)
+	 *  \param      screen  Terminal (nullptr - the current one)
+	 *  \param      fd      Descriptor the terminal writes to (-1 - every
+	 *                      frame waits for the terminal)
+	 */
+	explicit NTCursesSink(WINDOW *window = nullptr, SCREEN *screen = nullptr, int fd = -1);
+
+	/*! \brief  Destructor */
+	~NTCursesSink() override;
+
+	NTCursesSink(const NTCursesSink&) = delete;
+	NTCursesSink& operator=(const NTCursesSink&) = delete;
+
+	/*! \brief      Writes the changes of a frame
+	 *  \param      frame   Composed frame
+	 *  \return     NT_OK if success, NT_ERR if a cell failed to write
+	 */
+	int present(const NTFrameBuffer &frame) override;
+
+	/*! \brief  Writes the whole next frame */
+	void invalidate() override;
+
+	/*! \brief      Gets the number of cells written by the last present()
+	 *  \return     Number of cells
+	 */
+	size_t written() const override;
+
+	/*! \brief      Defines a color pair of the terminal
+	 *  \details    Does nothing if the terminal has no colors.
+	 *  \param      pair        Color pair
+	 *  \param      foreground  Foreground color (-1 - default)
+	 *  \param      background  Background color (-1 - default)
+	 */
+	void define(short pair, short foreground, short background) override;
+
+private:
+	/*! \brief      Checks if the terminal took the output of the last frame
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if a frame can be written without waiting
+	 */
+	bool ready() const;
+
+	/*! \brief      Makes the terminal of the sink current
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Terminal that was current (nullptr - not changed)
+	 */
+	SCREEN *enter();
+
+	/*! \brief      Makes the previous terminal current again
+	 *  \details    Must be called with _mutex held.
+	 *  \param      previous    Result of enter()
+	 */
+	void leave(SCREEN *previous);
+
+	/*! \brief      Copies the color pairs of the changed cells to the terminal
+	 *  \details    Must be called with _mutex held and the sink terminal current.
+	 *  \param      source  Terminal that drew the frame
+	 */
+	void copyPairs(SCREEN *source);
+
+	mutable std::mutex _mutex;	/*!< Guards the frame */
+	WINDOW *_window;			/*!< Window (nullptr - stdscr) */
+	SCREEN *_screen;			/*!< Terminal (nullptr - the current one) */
+	int _fd;					/*!< Output of the terminal (-1 - not watched) */
+	NTFrameBuffer _front;		/*!< Frame on the window */
+	size_t _written;			/*!< Cells written by the last present() */
+	std::vector<size_t> _changes;	/*!< Cells of the frame being written (row by row) */
+	std::vector<char> _pairs;	/*!< Color pairs known by the terminal */
+};
+
+#endif // _NTCURSESSINK_H_
@@ -0,0 +1,143 @@
+/*!	\file		ntframebuffer.cpp
+ *	\brief		Implementation of the NTFrameBuffer class
+ *	\details	Contains method implementations for in-memory screen cells in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntframebuffer.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Wide character widths */
+#include <cwchar>
+
+// Constructor
+NTFrameBuffer::NTFrameBuffer()
+	: _area({0, 0, 0, 0}) {}
+
+// Destructor
+NTFrameBuffer::~NTFrameBuffer() = default;
+
+// Sets the area and fills it
+void NTFrameBuffer::reset(const nt::Rect &area, const Cell &cell)
+{
+	_area = {area.x, area.y, std::max(area.width, 0), std::max(area.height, 0)};
+	_cells.assign(static_cast<size_t>(_area.width) * _area.height, cell);
+}
+
+// Fills a part of the area
+void NTFrameBuffer::fill(const nt::Rect &rect, const Cell &cell)
+{
+	int x0 = std::max(rect.x, _area.x), x1 = std::min(rect.x + rect.width, _area.x + _area.width);
+	int y0 = std::max(rect.y, _area.y), y1 = std::min(rect.y + rect.height, _area.y + _area.height);
+	if (x0 >= x1) return;
+	for (int y = y0; y < y1; y++) {
+		Cell *row = at(x0, y);
+		std::fill(row, row + (x1 - x0), cell);
+	}
+}
+
+// Gets the area of the buffer
+const nt::Rect &NTFrameBuffer::area() const
+{
+	return _area;
+}
+
+// Gets a cell
+NTFrameBuffer::Cell *NTFrameBuffer::at(int x, int y)
+{
+	x -= _area.x;
+	y -= _area.y;
+	if (x < 0 || y < 0 || x >= _area.width || y >= _area.height) return nullptr;
+	return &_cells[static_cast<size_t>(y) * _area.width + x];
+}
+
+// Gets a cell
+const NTFrameBuffer::Cell *NTFrameBuffer::at(int x, int y) const
+{
+	return const_cast<NTFrameBuffer *>(this)->at(x, y);
+}
+
+// Gets an empty screen cell
+NTFrameBuffer::Cell NTFrameBuffer::blank()
+{
+	return Cell{{L' '}, A_NORMAL, 0, NTF_GLYPH | NTF_ATTR};
+}
+
+// Gets a cell that was not written
+NTFrameBuffer::Cell NTFrameBuffer::empty()
+{
+	return Cell{{0}, A_NORMAL, 0, NTF_NONE};
+}
+
+// Compares two cells
+bool NTFrameBuffer::same(const Cell &a, const Cell &b)
+{
+	if (a.flags != b.flags || a.attr != b.attr || a.pair != b.pair) return false;
+	for (int i = 0; i < CCHARW_MAX; i++) {
+		if (a.text[i] != b.text[i]) return false;
+		if (a.text[i] == 0) break;
+	}
+	return true;
+}
+
+// Gets a cell as a terminal of a size shows it
+NTFrameBuffer::Cell NTFrameBuffer::shown(int x, int y, const nt::Size &size) const
+{
+	const Cell *cell = at(x, y);
+	if (!cell || cell->flags == NTF_NONE) return blank();
+
+	Cell result = *cell;
+	if (!(result.flags & NTF_GLYPH)) {
+		result.text[0] = L' ';
+		result.text[1] = 0;
+	}
+	result.flags |= NTF_GLYPH | NTF_ATTR;
+
+	const Cell *left = at(x - 1, y);
+	const Cell *right = x + 1 < size.width ? at(x + 1, y) : nullptr;
+	if (((result.flags & NTF_CONTINUATION) && !(left && (left->flags & NTF_GLYPH) && (left->flags & NTF_WIDE))) ||
+		((result.flags & NTF_WIDE) && !(right && (right->flags & NTF_GLYPH) && (right->flags & NTF_CONTINUATION)))) {
+		result.text[0] = L' ';
+		result.text[1] = 0;
+		result.flags &= ~(NTF_WIDE | NTF_CONTINUATION);
+	}
+	return result;
+}
+
+// Reads the cells of a window
+void NTFrameBuffer::capture(WINDOW *window)
+{
+	int max_y, max_x, cursor_y, cursor_x;
+	getmaxyx(window, max_y, max_x);
+	getyx(window, cursor_y, cursor_x);
+	reset({0, 0, max_x, max_y}, blank());
+
+	for (int y = 0; y < max_y; y++) {
+		for (int x = 0; x < max_x; x++) {
+			cchar_t input;
+			wchar_t text[CCHARW_MAX + 1] = {0};
+			attr_t attr;
+			short pair;
+			if (mvwin_wch(window, y, x, &input) == ERR || getcchar(&input, text, &attr, &pair, nullptr) == ERR) continue;
+
+			Cell &cell = *at(x, y);
+			std::copy(text, text + CCHARW_MAX - 1, cell.text);
+			cell.text[CCHARW_MAX - 1] = 0;
+			cell.attr = attr;
+			cell.pair = pair;
+
+			// Both columns of a wide glyph read the glyph: the right one becomes its continuation
+			if (wcwidth(text[0]) == 2 && x + 1 < max_x) {
+				cell.flags |= NTF_WIDE;
+				Cell &next = *at(++x, y);
+				next = cell;
+				next.text[0] = 0;
+				next.flags = NTF_GLYPH | NTF_ATTR | NTF_CONTINUATION;
+			}
+		}
+	}
+	wmove(window, cursor_y, cursor_x);
+}
@@ -0,0 +1,130 @@
+/*! \file       ntframebuffer.h
+ *  \brief      NT Frame Buffer module (header file).
+ *  \details    Contains the NTFrameBuffer class definitions: screen cells
+ *              kept in memory for rendering without ncurses.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMEBUFFER_H_
+#define _NTFRAMEBUFFER_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+
+#define NTF_NONE			0			/*!< Cell not written (shows the cell below) */
+#define NTF_GLYPH			(1 << 0)	/*!< Glyph of the cell is set */
+#define NTF_ATTR			(1 << 1)	/*!< Attrs and color pair of the cell are set */
+#define NTF_WIDE			(1 << 2)	/*!< Glyph is two columns wide */
+#define NTF_CONTINUATION	(1 << 3)	/*!< Right half of a wide glyph */
+
+/*! \class      NTFrameBuffer
+ *  \brief      Cells of a screen area in memory.
+ *  \details    A widget drawn with a frame buffer as its layer (see
+ *              NTGraphicObject::drawClipped()) writes the cells here instead
+ *              of an ncurses window, so it can be drawn on any thread. The
+ *              flags of a cell tell which parts of it were written: text
+ *              drawn without attrs keeps the attrs of the cell below, a
+ *              transparent space keeps its glyph (the same rules as in a
+ *              window).
+ *
+ *              Coordinates are screen coordinates. The buffer is not
+ *              thread-safe; threads must write separate cells.
+ */
+class NTFrameBuffer
+{
+public:
+	/*!	\brief	Cell of the buffer */
+	struct Cell {
+		wchar_t text[CCHARW_MAX];	/*!< Glyph (spacing character and combining marks) */
+		attr_t attr;				/*!< ncurses attrs */
+		short pair;					/*!< Color pair */
+		unsigned char flags;		/*!< NTF_* flags */
+	};
+
+	/*! \brief  Constructor (empty area) */
+	NTFrameBuffer();
+
+	/*! \brief  Destructor */
+	~NTFrameBuffer();
+
+	/*! \brief      Sets the area and fills it
+	 *  \param      area    Screen area
+	 *  \param      cell    Content of every cell
+	 */
+	void reset(const nt::Rect &area, const Cell &cell);
+
+	/*! \brief      Fills a part of the area
+	 *  \param      rect    Screen area (clipped to the buffer)
+	 *  \param      cell    Content of every cell
+	 */
+	void fill(const nt::Rect &rect, const Cell &cell);
+
+	/*! \brief      Gets the area of the buffer
+	 *  \return     Screen area
+	 */
+	const nt::Rect &area() const;
+
+	/*! \brief      Gets a cell
+	 *  \param      x   X coordinate
+	 *  \param      y   Y coordinate
+	 *  \return     Cell or nullptr if outside the area
+	 */
+	Cell *at(int x, int y);
+
+	/*! \brief      Gets a cell
+	 *  \param      x   X coordinate
+	 *  \param      y   Y coordinate
+	 *  \return     Cell or nullptr if outside the area
+	 */
+	const Cell *at(int x, int y) const;
+
+	/*! \brief      Gets an empty screen cell
+	 *  \return     Space with no attrs and color pair 0
+	 */
+	static Cell blank();
+
+	/*! \brief      Gets a cell that was not written
+	 *  \return     Cell with no flags
+	 */
+	static Cell empty();
+
+	/*! \brief      Compares two cells
+	 *  \param      a   Cell
+	 *  \param      b   Cell
+	 *  \return     true if the cells look the same
+	 */
+	static bool same(const Cell &a, const Cell &b);
+
+	/*! \brief      Gets a cell as a terminal of a size shows it
+	 *  \details    Cells outside the buffer or not written are blanks, a cell
+	 *              without a glyph shows a space. Halves of wide glyphs broken
+	 *              by the glyphs over them or by the edge of the terminal
+	 *              become spaces.
+	 *  \param      x       X coordinate
+	 *  \param      y       Y coordinate
+	 *  \param      size    Terminal size (from the screen origin)
+	 *  \return     Cell with the NTF_GLYPH and NTF_ATTR flags
+	 */
+	Cell shown(int x, int y, const nt::Size &size) const;
+
+	/*! \brief      Reads the cells of a window
+	 *  \details    The area becomes the window size at the screen origin. The
+	 *              cursor of the window is kept.
+	 *  \param      window  ncurses window
+	 */
+	void capture(WINDOW *window);
+
+private:
+	nt::Rect _area;				/*!< Screen area of the buffer */
+	std::vector<Cell> _cells;	/*!< Cells row by row */
+};
+
+#endif // _NTFRAMEBUFFER_H_
@@ -0,0 +1,300 @@
+/*!	\file		ntframecodec.cpp
+ *	\brief		Implementation of the NTFrameCodec class
+ *	\details	Contains method implementations for frame records in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntframecodec.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Limits of integer types */
+#include <climits>
+
+namespace {
+	// Appends a varint
+	void put(std::string &out, uint64_t value)
+	{
+		while (value >= 0x80) {
+			out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<char>(value));
+	}
+
+	// Appends a signed varint
+	void putSigned(std::string &out, int64_t value)
+	{
+		put(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+	}
+
+	// Reader of a record
+	struct Reader {
+		const unsigned char *data;	// next byte
+		const unsigned char *end;	// end of the data
+		bool truncated;				// read past the end
+
+		// Reads a byte
+		unsigned char byte()
+		{
+			if (data == end) {
+				truncated = true;
+				return 0;
+			}
+			return *data++;
+		}
+
+		// Reads a varint (10 bytes at most)
+		uint64_t number()
+		{
+			uint64_t value = 0;
+			for (int shift = 0; shift < 70; shift += 7) {
+				unsigned char next = byte();
+				if (truncated) return 0;
+				value |= static_cast<uint64_t>(next & 0x7f) << shift;
+				if (!(next & 0x80)) return value;
+			}
+			return UINT64_MAX;
+		}
+
+		// Reads a signed varint
+		int64_t signedNumber()
+		{
+			uint64_t value = number();
+			return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+		}
+	};
+}
+
+// Constructor
+NTFrameCodec::NTFrameCodec()
+	: _time(0), _key(true), _changed(0) {}
+
+// Destructor
+NTFrameCodec::~NTFrameCodec() = default;
+
+// Starts again: the next record is a keyframe
+void NTFrameCodec::reset()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_key = true;
+}
+
+// Encodes the changes of a frame
+size_t NTFrameCodec::encode(const NTFrameBuffer &frame, std::chrono::microseconds time, std::string &out)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	const nt::Rect &area = frame.area();
+	int width = std::min(area.width, nt::FRAME_MAX_SIZE), height = std::min(area.height, nt::FRAME_MAX_SIZE);
+
+	// New size or too many styles: a keyframe over an unknown frame
+	bool key = _key || _frame.area().width != width || _frame.area().height != height || _index.size() >= nt::FRAME_STYLES;
+	if (key) {
+		_frame.reset({0, 0, width, height}, NTFrameBuffer::empty());
+		_index.clear();
+	}
+
+	// Changed cells, kept as the new frame
+	_runs.clear();
+	nt::Size size = {width, height};
+	for (int y = 0; y < height; y++) {
+		NTFrameBuffer::Cell *shown = _frame.at(0, y);
+		for (int x = 0; x < width; x++, shown++) {
+			NTFrameBuffer::Cell cell = frame.shown(area.x + x, area.y + y, size);
+			if (NTFrameBuffer::same(cell, *shown)) continue;
+			*shown = cell;
+			size_t index = static_cast<size_t>(y) * width + x;
+			if (!_runs.empty() && _runs.back().second == index) {
+				_runs.back().second++;
+			} else {
+				_runs.push_back({index, index + 1});
+			}
+		}
+	}
+	if (_runs.empty() && !key) return 0;
+
+	// Runs of groups of equal cells
+	size_t changed = 0, end = 0;
+	_body.clear();
+	const NTFrameBuffer::Cell *cells = _frame.at(0, 0);
+	for (const auto &run : _runs) {
+		put(_body, run.first - end);
+		put(_body, run.second - run.first);
+		for (size_t first = run.first; first < run.second;) {
+			size_t last = first + 1;
+			while (last < run.second && NTFrameBuffer::same(cells[last], cells[first])) last++;
+			put(_body, last - first - 1);
+
+			const NTFrameBuffer::Cell &cell = cells[first];
+			auto style = _index.emplace(std::make_tuple(cell.attr, cell.pair, cell.flags), static_cast<uint32_t>(_index.size()));
+			put(_body, style.first->second);
+			if (style.second) {
+				short foreground = -1, background = -1;
+				if (cell.pair > 0 && pair_content(cell.pair, &foreground, &background) == ERR) foreground = background = -1;
+				put(_body, cell.attr);
+				putSigned(_body, cell.pair);
+				_body.push_back(static_cast<char>(cell.flags));
+				putSigned(_body, foreground);
+				putSigned(_body, background);
+			}
+			size_t count = 0;
+			while (count < CCHARW_MAX - 1 && cell.text[count]) count++;
+			put(_body, count);
+			for (size_t i = 0; i < count; i++) put(_body, static_cast<uint32_t>(cell.text[i]));
+
+			changed += last - first;
+			first = last;
+		}
+		end = run.second;
+	}
+
+	out.push_back(key ? nt::FRAME_KEY : nt::FRAME_DELTA);
+	put(out, static_cast<uint64_t>(std::max(time - _time, std::chrono::microseconds(0)).count()));
+	if (key) {
+		put(out, static_cast<uint64_t>(width));
+		put(out, static_cast<uint64_t>(height));
+	}
+	put(out, _runs.size());
+	out += _body;
+
+	_time = std::max(time, _time);
+	_key = false;
+	_changed = changed;
+	return changed;
+}
+
+// Decodes a record into the frame
+long NTFrameCodec::decode(const char *data, size_t size)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	long result = parse(data, size, false);
+	if (result > 0) parse(data, size, true);
+	return result;
+}
+
+// Gets the decoded frame
+const NTFrameBuffer &NTFrameCodec::frame() const
+{
+	return _frame;
+}
+
+// Gets the time of the last record
+std::chrono::microseconds NTFrameCodec::time() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _time;
+}
+
+// Gets the number of cells of the last record
+size_t NTFrameCodec::changed() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _changed;
+}
+
+// Gets the color pairs defined by the last decoded record
+const std::vector<NTFrameCodec::Pair> &NTFrameCodec::pairs() const
+{
+	return _pairs;
+}
+
+// Decodes a record
+long NTFrameCodec::parse(const char *data, size_t size, bool apply)
+{
+	Reader reader = {reinterpret_cast<const unsigned char *>(data), reinterpret_cast<const unsigned char *>(data) + size, false};
+
+	char kind = static_cast<char>(reader.byte());
+	uint64_t delta = reader.number();
+	if (reader.truncated) return 0;
+	if (kind != nt::FRAME_KEY && kind != nt::FRAME_DELTA) return -1;
+	if (delta > static_cast<uint64_t>(INT64_MAX) - static_cast<uint64_t>(_time.count())) return -1;
+
+	// A delta needs the frame of a keyframe before it
+	bool key = kind == nt::FRAME_KEY;
+	uint64_t width = _frame.area().width, height = _frame.area().height;
+	if (key) {
+		width = reader.number();
+		height = reader.number();
+		if (reader.truncated) return 0;
+		if (width > nt::FRAME_MAX_SIZE || height > nt::FRAME_MAX_SIZE) return -1;
+	} else if (_key) {
+		return -1;
+	}
+	size_t styles = key ? 0 : _styles.size();
+	uint64_t cells = width * height;
+
+	if (apply) {
+		if (key) {
+			_frame.reset({0, 0, static_cast<int>(width), static_cast<int>(height)}, NTFrameBuffer::blank());
+			_styles.clear();
+		}
+		_pairs.clear();
+		_time += std::chrono::microseconds(delta);
+		_key = false;
+		_changed = 0;
+	}
+
+	uint64_t runs = reader.number();
+	if (reader.truncated) return 0;
+	uint64_t next = 0;
+	for (uint64_t run = 0; run < runs; run++) {
+		uint64_t skip = reader.number();
+		uint64_t length = reader.number();
+		if (reader.truncated) return 0;
+		if (skip > cells - next || length > cells - next - skip) return -1;
+		next += skip;
+
+		uint64_t end = next + length;
+		while (next < end) {
+			uint64_t repeat = reader.number();
+			uint64_t index = reader.number();
+			if (reader.truncated) return 0;
+			if (repeat >= end - next || index > styles) return -1;
+
+			Style style = {A_NORMAL, 0, NTF_NONE};
+			if (index == styles) {
+				uint64_t attr = reader.number();
+				int64_t pair = reader.signedNumber();
+				unsigned char flags = reader.byte();
+				int64_t foreground = reader.signedNumber();
+				int64_t background = reader.signedNumber();
+				if (reader.truncated) return 0;
+				if (attr > static_cast<attr_t>(-1) || pair < 0 || pair > SHRT_MAX || foreground < -1 || foreground > SHRT_MAX ||
+					background < -1 || background > SHRT_MAX) {
+					return -1;
+				}
+				style = {static_cast<attr_t>(attr), static_cast<short>(pair), flags};
+				styles++;
+				if (apply) {
+					_styles.push_back(style);
+					if (pair > 0) _pairs.push_back({static_cast<short>(pair), static_cast<short>(foreground), static_cast<short>(background)});
+				}
+			} else if (apply) {
+				style = _styles[index];
+			}
+
+			NTFrameBuffer::Cell cell = {{0}, style.attr, style.pair, style.flags};
+			uint64_t count = reader.number();
+			if (reader.truncated) return 0;
+			if (count >= CCHARW_MAX) return -1;
+			for (uint64_t i = 0; i < count; i++) {
+				uint64_t code = reader.number();
+				if (reader.truncated) return 0;
+				if (code > 0x10ffff) return -1;
+				cell.text[i] = static_cast<wchar_t>(code);
+			}
+
+			if (apply) {
+				for (uint64_t i = 0; i <= repeat; i++) {
+					uint64_t at = next + i;
+					*_frame.at(static_cast<int>(at % width), static_cast<int>(at / width)) = cell;
+				}
+				_changed += repeat + 1;
+			}
+			next += repeat + 1;
+		}
+	}
+	return static_cast<long>(reader.data - reinterpret_cast<const unsigned char *>(data));
+}
@@ -0,0 +1,159 @@
+/*! \file       ntframecodec.h
+ *  \brief      NT Frame codec module (header file).
+ *  \details    Contains the frame record format and the NTFrameCodec class
+ *              definitions: compact cell diffs of composed frames for
+ *              recordings and streams.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMECODEC_H_
+#define _NTFRAMECODEC_H_
+
+/*! \brief  Standard integer types */
+#include <cstdint>
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Ordered map */
+#include <map>
+/*! \brief  Tuples */
+#include <tuple>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Time durations */
+#include <chrono>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+
+/*!
+ *  \namespace nt
+ *  \brief     Namespace containing core types for NT project
+ */
+namespace nt {
+	constexpr char FRAME_KEY	= 'K';	/*!< Record of a whole frame */
+	constexpr char FRAME_DELTA	= 'D';	/*!< Record of the changed cells */
+
+	constexpr size_t FRAME_STYLES = 4096;	/*!< Styles interned before the encoder starts a new keyframe */
+	constexpr int FRAME_MAX_SIZE = 4096;	/*!< Largest frame width and height */
+}
+
+/*! \class      NTFrameCodec
+ *  \brief      Encoder and decoder of frame records.
+ *  \details    A record holds the cells of a frame that differ from the
+ *              frame before it. Numbers are LEB128 varints (signed ones
+ *              zigzag-encoded):
+ *              - kind: nt::FRAME_KEY or nt::FRAME_DELTA (one byte);
+ *              - time since the previous record in microseconds;
+ *              - a keyframe only: width and height;
+ *              - number of runs, then every run: cells skipped since the
+ *                end of the previous run (row by row), run length and its
+ *                cells in groups: repeat count - 1 and the cell.
+ *
+ *              A cell is its style index and its glyph (number of code
+ *              points, then the code points). Styles (attrs, color pair,
+ *              NTF_* flags and the colors of the pair) are interned: an index
+ *              equal to the number of known styles adds the style that
+ *              follows it. A keyframe clears the styles, so decoding can
+ *              start at any keyframe.
+ *
+ *              The same codec encodes or decodes, not both. Cells are
+ *              taken as the terminal shows them (see NTFrameBuffer::shown()).
+ */
+class NTFrameCodec
+{
+public:
+	/*!	\brief	Color pair defined by a record */
+	struct Pair {
+		short pair;			/*!< Color pair */
+		short foreground;	/*!< Foreground color (-1 - default) */
+		short background;	/*!< Background color (-1 - default) */
+	};
+
+	/*! \brief  Constructor */
+	NTFrameCodec();
+
+	/*! \brief  Destructor */
+	~NTFrameCodec();
+
+	NTFrameCodec(const NTFrameCodec&) = delete;
+	NTFrameCodec& operator=(const NTFrameCodec&) = delete;
+
+	/*! \brief  Starts again: the next record is a keyframe */
+	void reset();
+
+	/*! \brief      Encodes the changes of a frame
+	 *  \details    Nothing is added if no cell changed: the time of an
+	 *              unchanged frame goes to the next record.
+	 *  \param      frame   Composed frame (its area is the screen)
+	 *  \param      time    Time of the frame since the start
+	 *  \param      out     Record is appended here
+	 *  \return     Number of cells encoded
+	 */
+	size_t encode(const NTFrameBuffer &frame, std::chrono::microseconds time, std::string &out);
+
+	/*! \brief      Decodes a record into the frame
+	 *  \param      data    Record
+	 *  \param      size    Bytes available
+	 *  \return     Size of the record in bytes,
+	 *              0 if the record is not complete (nothing is decoded),
+	 *              -1 if the data is not a valid record
+	 */
+	long decode(const char *data, size_t size);
+
+	/*! \brief      Gets the decoded frame
+	 *  \return     Frame at the screen origin
+	 */
+	const NTFrameBuffer &frame() const;
+
+	/*! \brief      Gets the time of the last record
+	 *  \return     Time since the start
+	 */
+	std::chrono::microseconds time() const;
+
+	/*! \brief      Gets the number of cells of the last record
+	 *  \return     Number of cells
+	 */
+	size_t changed() const;
+
+	/*! \brief      Gets the color pairs defined by the last decoded record
+	 *  \return     Pairs to define before the frame is shown
+	 */
+	const std::vector<Pair> &pairs() const;
+
+private:
+	/*!	\brief	Style of cells */
+	struct Style {
+		attr_t attr;			/*!< ncurses attrs */
+		short pair;				/*!< Color pair */
+		unsigned char flags;	/*!< NTF_* flags */
+	};
+
+	/*! \brief      Decodes a record
+	 *  \details    Must be called with _mutex held. Checks the record without
+	 *              changing anything first, then applies it.
+	 *  \param      data    Record
+	 *  \param      size    Bytes available
+	 *  \param      apply   Change the frame and the styles
+	 *  \return     As decode()
+	 */
+	long parse(const char *data, size_t size, bool apply);
+
+	mutable std::mutex _mutex;		/*!< Guards the state */
+	NTFrameBuffer _frame;			/*!< Last frame encoded or decoded */
+	std::chrono::microseconds _time;	/*!< Time of the last record */
+	bool _key;						/*!< Next record is a keyframe */
+	size_t _changed;				/*!< Cells of the last record */
+	std::map<std::tuple<attr_t, short, unsigned char>, uint32_t> _index;	/*!< Encoder: index of every style */
+	std::vector<Style> _styles;		/*!< Decoder: styles by index */
+	std::vector<Pair> _pairs;		/*!< Decoder: pairs defined by the last record */
+	std::string _body;				/*!< Encoder: runs of the record being built */
+	std::vector<std::pair<size_t, size_t>> _runs;	/*!< Encoder: changed cells (first, end) */
+};
+
+#endif // _NTFRAMECODEC_H_
@@ -0,0 +1,115 @@
+/*!	\file		ntframerecorder.cpp
+ *	\brief		Implementation of the NTFrameRecorder class
+ *	\details	Contains method implementations for frame recordings in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntframerecorder.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+// Constructor
+NTFrameRecorder::NTFrameRecorder()
+	: _file(nullptr), _written(0), _frames(0), _bytes(0) {}
+
+// Destructor
+NTFrameRecorder::~NTFrameRecorder()
+{
+	close();
+}
+
+// Creates the recording
+int NTFrameRecorder::open(const std::string &path)
+{
+	close();
+	std::lock_guard<std::mutex> lock(_mutex);
+	_file = std::fopen(path.c_str(), "wb");
+	if (!_file) return NT_ERR;
+
+	char header[sizeof(nt::RECORDING_MAGIC) + 1];
+	std::copy(std::begin(nt::RECORDING_MAGIC), std::end(nt::RECORDING_MAGIC), header);
+	header[sizeof(nt::RECORDING_MAGIC)] = static_cast<char>(nt::RECORDING_VERSION);
+	if (std::fwrite(header, 1, sizeof(header), _file) != sizeof(header)) {
+		std::fclose(_file);
+		_file = nullptr;
+		return NT_ERR;
+	}
+
+	_codec.reset();
+	_start = std::chrono::steady_clock::now();
+	_written = 0;
+	_frames = 0;
+	_bytes = sizeof(header);
+	return NT_OK;
+}
+
+// Closes the recording
+void NTFrameRecorder::close()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_file) return;
+	std::fclose(_file);
+	_file = nullptr;
+}
+
+// Records the changes of a frame
+int NTFrameRecorder::present(const NTFrameBuffer &frame)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return record(frame);
+}
+
+// Records the cells of a window
+int NTFrameRecorder::capture(WINDOW *window)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_file) return NT_ERR;
+	_captured.capture(window ? window : stdscr);
+	return record(_captured);
+}
+
+// Records the whole next frame
+void NTFrameRecorder::invalidate()
+{
+	_codec.reset();
+}
+
+// Writes the record of a frame
+int NTFrameRecorder::record(const NTFrameBuffer &frame)
+{
+	if (!_file) return NT_ERR;
+	auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start);
+	_record.clear();
+	_written = _codec.encode(frame, time, _record);
+	if (_record.empty()) return NT_OK;
+
+	// Flushed record by record: a recording stopped by a crash ends at its last frame
+	if (std::fwrite(_record.data(), 1, _record.size(), _file) != _record.size() || std::fflush(_file) != 0) return NT_ERR;
+	_frames++;
+	_bytes += _record.size();
+	return NT_OK;
+}
+
+// Gets the number of cells recorded by the last frame
+size_t NTFrameRecorder::written() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _written;
+}
+
+// Gets the number of records
+size_t NTFrameRecorder::frames() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _frames;
+}
+
+// Gets the size of the recording
+size_t NTFrameRecorder::bytes() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _bytes;
+}
@@ -0,0 +1,127 @@
+/*! \file       ntframerecorder.h
+ *  \brief      NT Frame recorder module (header file).
+ *  \details    Contains the recording file format and the NTFrameRecorder
+ *              class definitions: frames saved as timed cell diffs.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMERECORDER_H_
+#define _NTFRAMERECORDER_H_
+
+/*! \brief  Standard C input/output */
+#include <cstdio>
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Time durations */
+#include <chrono>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+/*! \brief  Frame records */
+#include "ntframecodec.h"
+
+/*!
+ *  \namespace nt
+ *  \brief     Namespace containing core types for NT project
+ */
+namespace nt {
+	constexpr char RECORDING_MAGIC[4] = {'N', 'T', 'F', 'R'};	/*!< Recording file magic */
+	constexpr unsigned char RECORDING_VERSION = 1;				/*!< Recording format version */
+}
+
+/*! \class      NTFrameRecorder
+ *  \brief      Recorder of frames into a file.
+ *  \details    A recording is nt::RECORDING_MAGIC, the version byte and the
+ *              records of the frames (see NTFrameCodec): a keyframe, then the
+ *              cells changed by every frame with the time since the frame
+ *              before. Frames with no change take no space. Every record is
+ *              flushed, so a recording is complete up to the last frame even
+ *              if the program stops.
+ *
+ *              The recorder is a frame sink, or it reads the screen of
+ *              ncurses with capture() (after the frame is drawn, for NTScreen
+ *              and NTPanel output).
+ */
+class NTFrameRecorder : public NTFrameSink
+{
+public:
+	/*! \brief  Constructor */
+	NTFrameRecorder();
+
+	/*! \brief  Destructor (closes the file) */
+	~NTFrameRecorder() override;
+
+	NTFrameRecorder(const NTFrameRecorder&) = delete;
+	NTFrameRecorder& operator=(const NTFrameRecorder&) = delete;
+
+	/*! \brief      Creates the recording
+	 *  \details    Times of the frames count from now.
+	 *  \param      path    Path to the file
+	 *  \return     NT_OK if success, NT_ERR otherwise
+	 */
+	int open(const std::string &path);
+
+	/*! \brief  Closes the recording */
+	void close();
+
+	/*! \brief      Records the changes of a frame
+	 *  \param      frame   Composed frame
+	 *  \return     NT_OK if success, NT_ERR if not open or the file failed
+	 */
+	int present(const NTFrameBuffer &frame) override;
+
+	/*! \brief      Records the cells of a window
+	 *  \param      window  Window (nullptr - stdscr)
+	 *  \return     NT_OK if success, NT_ERR if not open or the file failed
+	 */
+	int capture(WINDOW *window = nullptr);
+
+	/*! \brief  Records the whole next frame */
+	void invalidate() override;
+
+	/*! \brief      Gets the number of cells recorded by the last frame
+	 *  \return     Number of cells
+	 */
+	size_t written() const override;
+
+	/*! \brief      Gets the number of records
+	 *  \return     Number of frames that changed cells
+	 */
+	size_t frames() const;
+
+	/*! \brief      Gets the size of the recording
+	 *  \return     Size in bytes
+	 */
+	size_t bytes() const;
+
+private:
+	/*! \brief      Writes the record of a frame
+	 *  \details    Must be called with _mutex held.
+	 *  \param      frame   Frame
+	 *  \return     NT_OK if success, NT_ERR if not open or the file failed
+	 */
+	int record(const NTFrameBuffer &frame);
+
+	mutable std::mutex _mutex;		/*!< Guards the recording */
+	FILE *_file;					/*!< Recording (nullptr - closed) */
+	NTFrameCodec _codec;			/*!< Encoder of the frames */
+	NTFrameBuffer _captured;		/*!< Cells read by capture() */
+	std::string _record;			/*!< Record being written */
+	std::chrono::steady_clock::time_point _start;	/*!< Time 0 of the recording */
+	size_t _written;				/*!< Cells of the last frame */
+	size_t _frames;					/*!< Records written */
+	size_t _bytes;					/*!< Bytes written */
+};
+
+#endif // _NTFRAMERECORDER_H_
@@ -0,0 +1,97 @@
+/*!	\file		ntframereplayer.cpp
+ *	\brief		Implementation of the NTFrameReplayer class
+ *	\details	Contains method implementations for frame recording playback in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntframereplayer.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Threads */
+#include <thread>
+
+/*! \brief  Recording file format */
+#include "ntframerecorder.h"
+
+// Constructor
+NTFrameReplayer::NTFrameReplayer()
+	: _open(false), _stats({0, 0, 0, 0, std::chrono::microseconds(0), std::chrono::microseconds(0)}) {}
+
+// Destructor
+NTFrameReplayer::~NTFrameReplayer() = default;
+
+// Opens a recording
+int NTFrameReplayer::open(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_file.close();
+	_open = false;
+	if (_file.open(path) != NT_OK) return NT_ERR;
+
+	size_t header = sizeof(nt::RECORDING_MAGIC) + 1;
+	if (_file.size() < header || !std::equal(std::begin(nt::RECORDING_MAGIC), std::end(nt::RECORDING_MAGIC), _file.data()) ||
+		static_cast<unsigned char>(_file.data()[header - 1]) != nt::RECORDING_VERSION) {
+		_file.close();
+		return NT_ERR;
+	}
+	_open = true;
+	return NT_OK;
+}
+
+// Closes the recording
+void NTFrameReplayer::close()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_file.close();
+	_open = false;
+}
+
+// Plays the recording
+int NTFrameReplayer::play(NTFrameSink &sink, double speed)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_stats = {0, 0, 0, 0, std::chrono::microseconds(0), std::chrono::microseconds(0)};
+	if (!_open) return NT_ERR;
+
+	NTFrameCodec codec;
+	sink.invalidate();
+	int result = NT_OK;
+	const char *data = _file.data() + sizeof(nt::RECORDING_MAGIC) + 1;
+	const char *end = _file.data() + _file.size();
+	auto start = std::chrono::steady_clock::now();
+
+	while (data < end) {
+		long size = codec.decode(data, static_cast<size_t>(end - data));
+		if (size == 0) break;	// cut by the end of the recording
+		if (size < 0) {
+			result = NT_ERR;
+			break;
+		}
+		data += size;
+
+		if (speed > 0) {
+			std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+													  std::chrono::duration<double, std::micro>(codec.time().count() / speed)));
+		}
+		for (const NTFrameCodec::Pair &pair : codec.pairs()) sink.define(pair.pair, pair.foreground, pair.background);
+		if (sink.present(codec.frame()) != NT_OK) result = NT_ERR;
+
+		_stats.frames++;
+		_stats.cells += codec.changed();
+		_stats.written += sink.written();
+		_stats.bytes += static_cast<size_t>(size);
+		_stats.recorded = codec.time();
+	}
+	_stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	return result;
+}
+
+// Gets the measures of the last playback
+NTFrameReplayer::Stats NTFrameReplayer::stats() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _stats;
+}
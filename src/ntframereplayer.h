@@ -0,0 +1,90 @@
+/*! \file       ntframereplayer.h
+ *  \brief      NT Frame replayer module (header file).
+ *  \details    Contains the NTFrameReplayer class definitions: playback of
+ *              frame recordings through a frame sink.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMEREPLAYER_H_
+#define _NTFRAMEREPLAYER_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Time durations */
+#include <chrono>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+/*! \brief  Frame records */
+#include "ntframecodec.h"
+/*! \brief  Read-only mapped file */
+#include "ntmappedfile.h"
+
+/*! \class      NTFrameReplayer
+ *  \brief      Playback of a frame recording.
+ *  \details    Decodes the records of a recording (see NTFrameRecorder)
+ *              from the mapped file and presents every frame to a sink, at
+ *              the recorded times scaled by the speed, or as fast as the sink
+ *              takes them. The stats give the throughput of the sink on a
+ *              real workload. A recording cut in the middle of a record
+ *              plays up to the record before it.
+ */
+class NTFrameReplayer
+{
+public:
+	/*!	\brief	Measures of the playback */
+	struct Stats {
+		size_t frames;						/*!< Frames presented */
+		size_t cells;						/*!< Cells changed by the records */
+		size_t written;						/*!< Cells written by the sink */
+		size_t bytes;						/*!< Bytes of the records */
+		std::chrono::microseconds recorded;	/*!< Time of the last frame in the recording */
+		std::chrono::microseconds elapsed;	/*!< Time of the playback */
+	};
+
+	/*! \brief  Constructor */
+	NTFrameReplayer();
+
+	/*! \brief  Destructor */
+	~NTFrameReplayer();
+
+	NTFrameReplayer(const NTFrameReplayer&) = delete;
+	NTFrameReplayer& operator=(const NTFrameReplayer&) = delete;
+
+	/*! \brief      Opens a recording
+	 *  \param      path    Path to the file
+	 *  \return     NT_OK if success, NT_ERR if the file is not a recording
+	 */
+	int open(const std::string &path);
+
+	/*! \brief  Closes the recording */
+	void close();
+
+	/*! \brief      Plays the recording
+	 *  \details    The sink is invalidated first, so it gets whole frames.
+	 *  \param      sink    Output of the frames
+	 *  \param      speed   Speed (1.0 - recorded times, 0 - as fast as possible)
+	 *  \return     NT_OK if success,
+	 *              NT_ERR if not open, a record is not valid or the sink failed
+	 */
+	int play(NTFrameSink &sink, double speed = 1.0);
+
+	/*! \brief      Gets the measures of the last playback
+	 *  \return     Stats
+	 */
+	Stats stats() const;
+
+private:
+	mutable std::mutex _mutex;		/*!< Guards the recording and the stats */
+	NTMappedFile _file;				/*!< Recording */
+	bool _open;						/*!< Recording is open */
+	Stats _stats;					/*!< Measures of the last playback */
+};
+
+#endif // _NTFRAMEREPLAYER_H_
@@ -0,0 +1,246 @@
+/*!	\file		ntframescheduler.cpp
+ *	\brief		Implementation of the NTFrameScheduler class
+ *	\details	Contains method implementations for the frame loop in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntframescheduler.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Threads */
+#include <thread>
+/*! \brief  Error numbers */
+#include <cerrno>
+
+/*! \brief  POSIX pipes and descriptors */
+#include <unistd.h>
+/*! \brief  Descriptor flags */
+#include <fcntl.h>
+/*! \brief  Waiting for descriptors */
+#include <poll.h>
+
+/*! \brief  Terminal resize handling */
+#include "ntterminal.h"
+
+namespace {
+	const int levels[] = {INT_MIN, NTP_NORMAL, NTP_CRITICAL};	// lowest priority drawn at every level
+	const int topLevel = 2;
+	const int raiseAfter = 2;		// frames over the budget before deferring more widgets
+	const int lowerAfter = 8;		// frames within half the budget before drawing more widgets
+
+	// Sets the descriptor flags
+	bool configure(int fd)
+	{
+		return fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != -1 &&
+			   fcntl(fd, F_SETFD, FD_CLOEXEC) != -1;
+	}
+
+	// Gets the time since a point
+	std::chrono::microseconds since(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+	}
+}
+
+// Constructor
+NTFrameScheduler::NTFrameScheduler(NTScreen *screen, std::chrono::microseconds target)
+	: _screen(screen), _timers(nullptr), _animator(nullptr), _target(target), _idle(std::max(target, std::chrono::microseconds(std::chrono::milliseconds(250)))),
+	_input(-1), _pipe{-1, -1}, _level(0), _over(0), _under(0),
+	_stats({std::chrono::microseconds(0), std::chrono::microseconds(0), std::chrono::microseconds(0), target, INT_MIN, 0, false})
+{
+	if (pipe(_pipe) != 0 || !configure(_pipe[0]) || !configure(_pipe[1])) {
+		for (int &fd : _pipe) {
+			if (fd >= 0) close(fd);
+			fd = -1;
+		}
+	}
+}
+
+// Destructor
+NTFrameScheduler::~NTFrameScheduler()
+{
+	for (int fd : _pipe) {
+		if (fd >= 0) close(fd);
+	}
+}
+
+// Sets the target frame time
+void NTFrameScheduler::setTargetFrameTime(std::chrono::microseconds time)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_target = time;
+	_idle = std::max(_idle, time);
+	_stats.interval = time;
+}
+
+// Gets the target frame time
+std::chrono::microseconds NTFrameScheduler::targetFrameTime() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _target;
+}
+
+// Sets the longest frame time while idle
+void NTFrameScheduler::setIdleFrameTime(std::chrono::microseconds time)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_idle = std::max(time, _target);
+	_stats.interval = std::min(_stats.interval, _idle);
+}
+
+// Sets the function run at the start of every frame
+void NTFrameScheduler::setUpdate(std::function<void()> update)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_update = std::move(update);
+}
+
+// Sets the timer wheel advanced at the start of every frame
+void NTFrameScheduler::setTimers(NTTimerWheel *timers)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_timers = timers;
+}
+
+// Sets the animator stepped at the start of every frame
+void NTFrameScheduler::setAnimator(NTAnimator *animator)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_animator = animator;
+}
+
+// Sets the descriptor whose input starts a frame early
+void NTFrameScheduler::setInput(int fd)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_input = fd;
+}
+
+// Starts the next frame early
+void NTFrameScheduler::wake()
+{
+	if (_pipe[1] < 0) return;
+	char byte = 1;
+	ssize_t written = ::write(_pipe[1], &byte, 1);	// a full pipe already wakes the loop
+	(void)written;
+}
+
+// Gets the measures of the last frame
+NTFrameScheduler::Stats NTFrameScheduler::stats() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _stats;
+}
+
+// Waits for the start of the next frame
+void NTFrameScheduler::wait(std::chrono::steady_clock::time_point earliest, std::chrono::steady_clock::time_point latest)
+{
+	std::this_thread::sleep_until(earliest);
+
+	int input;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		input = _input;
+	}
+	struct pollfd fds[3];
+	nfds_t count = 0;
+	for (int fd : {_pipe[0], NTTerminal::fd(), input}) {
+		if (fd >= 0) fds[count++] = {fd, POLLIN, 0};
+	}
+
+	for (;;) {
+		auto left = std::chrono::ceil<std::chrono::milliseconds>(latest - std::chrono::steady_clock::now());
+		int ready = poll(fds, count, static_cast<int>(std::max<long long>(left.count(), 0)));
+		if (ready < 0 && errno == EINTR) continue;
+		break;
+	}
+
+	// Requests of wake() are served by this frame
+	char bytes[64];
+	if (_pipe[0] >= 0) {
+		while (::read(_pipe[0], bytes, sizeof(bytes)) > 0) {}
+	}
+}
+
+// Adapts the priority and the interval to a frame
+void NTFrameScheduler::adapt(std::chrono::microseconds work, bool idle)
+{
+	// Over the budget: defer lower priorities; well within it: draw them again
+	if (work > _target) {
+		_under = 0;
+		if (++_over >= raiseAfter && _level < topLevel) {
+			_level++;
+			_over = 0;
+		}
+	} else if (work * 2 < _target) {
+		_over = 0;
+		if (++_under >= lowerAfter && _level > 0) {
+			_level--;
+			_under = 0;
+		}
+	} else {
+		_over = 0;
+		_under = 0;
+	}
+
+	// Nothing left to defer: space the frames out to what the terminal takes
+	if (_level == topLevel) {
+		_stats.interval = std::max(_target, work + work / 4);
+	} else if (idle && _level == 0) {
+		_stats.interval = std::min(std::max(_stats.interval * 2, _target), _idle);
+	} else {
+		_stats.interval = _target;
+	}
+	_stats.priority = levels[_level];
+}
+
+// Waits for the next frame, then updates and draws it
+int NTFrameScheduler::frame()
+{
+	std::chrono::steady_clock::time_point earliest, latest;
+	std::function<void()> update;
+	NTTimerWheel *timers;
+	NTAnimator *animator;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		earliest = _last + _target;
+		latest = _last + _stats.interval;
+		update = _update;
+		timers = _timers;
+		animator = _animator;
+	}
+	if (animator && animator->size() > 0) latest = std::min(latest, _last + _target);
+	if (timers) latest = std::min(latest, timers->next());
+	wait(earliest, latest);
+
+	// A late frame starts the schedule again instead of catching up
+	auto start = std::chrono::steady_clock::now();
+	int priority;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_last = start;
+		priority = levels[_level];
+	}
+
+	if (timers) timers->advance(start);
+	if (animator) animator->advance(start);
+	if (update) update();
+	auto updated = std::chrono::steady_clock::now();
+	int result = _screen->draw(priority);
+	nt::Rect damaged = _screen->damaged();
+	size_t deferred = _screen->deferred();
+	std::chrono::microseconds raster = _screen->rasterTime();
+	std::chrono::microseconds output = _screen->outputTime();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_stats.update = since(start, updated);
+	_stats.raster = raster;
+	_stats.output = output;
+	_stats.deferred = deferred;
+	_stats.idle = (damaged.width <= 0 || damaged.height <= 0) && deferred == 0;
+	adapt(_stats.update + raster + output, _stats.idle);
+	return result;
+}
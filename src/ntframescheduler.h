@@ -0,0 +1,167 @@
+/*! \file       ntframescheduler.h
+ *  \brief      NT Frame Scheduler module (header file).
+ *  \details    Contains the NTFrameScheduler class definitions: frame loop
+ *              with a time budget and an adaptive frame rate.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMESCHEDULER_H_
+#define _NTFRAMESCHEDULER_H_
+
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Function wrapper */
+#include <functional>
+/*! \brief  Time durations */
+#include <chrono>
+
+/*! \brief  Widget compositor */
+#include "ntscreen.h"
+/*! \brief  Timer service */
+#include "nttimerwheel.h"
+/*! \brief  Tween engine */
+#include "ntanimator.h"
+
+/*! \class      NTFrameScheduler
+ *  \brief      Frame loop of a screen.
+ *  \details    Every frame() waits for the start of the next frame, runs
+ *              the update function and draws the screen, and measures the
+ *              three phases: update, raster (drawing of the widgets) and
+ *              output (writing to the terminal).
+ *
+ *              When a frame takes longer than the target frame time, the
+ *              next frames draw only the widgets of higher priority: first
+ *              NTP_BACKGROUND widgets (animations) are deferred, then all
+ *              but NTP_CRITICAL ones. Deferred widgets keep their changes
+ *              and are drawn again when the frames fit the budget for a
+ *              while. If even the critical widgets do not fit (the output
+ *              over a slow link), frames are spaced out to the time they
+ *              take, so the terminal is never sent more than it shows: every
+ *              frame writes the current state, nothing is queued.
+ *
+ *              When frames have nothing to draw, the interval doubles up to
+ *              the idle frame time. Input on the watched descriptor, a
+ *              terminal resize (see NTTerminal), the nearest timer of the
+ *              timer wheel or wake() start the next frame early, but not
+ *              before the target frame time. Timers added from another
+ *              thread while the loop waits need a wake().
+ *
+ *              frame() must be called from the thread that draws. The
+ *              scheduler does not own the screen.
+ */
+class NTFrameScheduler
+{
+public:
+	/*!	\brief	Measures of the last frame */
+	struct Stats {
+		std::chrono::microseconds update;	/*!< Time of the timers, the tweens and the update function */
+		std::chrono::microseconds raster;	/*!< Time of drawing the widgets */
+		std::chrono::microseconds output;	/*!< Time of writing to the terminal */
+		std::chrono::microseconds interval;	/*!< Time until the next frame */
+		int priority;						/*!< Lowest priority drawn by the next frame */
+		size_t deferred;					/*!< Widgets deferred by the last frame */
+		bool idle;							/*!< Last frame drew nothing */
+	};
+
+	/*! \brief      Constructor
+	 *  \param      screen  Screen to draw
+	 *  \param      target  Target frame time
+	 */
+	explicit NTFrameScheduler(NTScreen *screen, std::chrono::microseconds target = std::chrono::milliseconds(33));
+
+	/*! \brief  Destructor */
+	~NTFrameScheduler();
+
+	NTFrameScheduler(const NTFrameScheduler&) = delete;
+	NTFrameScheduler& operator=(const NTFrameScheduler&) = delete;
+
+	/*! \brief      Sets the target frame time (the budget of a frame)
+	 *  \param      time    Frame time
+	 */
+	void setTargetFrameTime(std::chrono::microseconds time);
+
+	/*! \brief      Gets the target frame time
+	 *  \return     Frame time
+	 */
+	std::chrono::microseconds targetFrameTime() const;
+
+	/*! \brief      Sets the longest frame time while idle
+	 *  \param      time    Frame time (not less than the target)
+	 */
+	void setIdleFrameTime(std::chrono::microseconds time);
+
+	/*! \brief      Sets the function run at the start of every frame
+	 *  \details    It updates the widgets; called without any mutex held.
+	 *  \param      update  Update function
+	 */
+	void setUpdate(std::function<void()> update);
+
+	/*! \brief      Sets the timer wheel advanced at the start of every frame
+	 *  \details    Its callbacks run before the update function. The wheel
+	 *              is not owned.
+	 *  \param      timers  Timer wheel (nullptr - none)
+	 */
+	void setTimers(NTTimerWheel *timers);
+
+	/*! \brief      Sets the animator stepped at the start of every frame
+	 *  \details    Its tweens are stepped after the timers, before the update
+	 *              function. While tweens run, frames are not idle. The
+	 *              animator is not owned.
+	 *  \param      animator    Animator (nullptr - none)
+	 */
+	void setAnimator(NTAnimator *animator);
+
+	/*! \brief      Sets the descriptor whose input starts a frame early
+	 *  \details    The update function must read the input, or frames run
+	 *              at the target rate.
+	 *  \param      fd      File descriptor (-1 - none)
+	 */
+	void setInput(int fd);
+
+	/*! \brief  Starts the next frame early (from any thread) */
+	void wake();
+
+	/*! \brief      Gets the measures of the last frame
+	 *  \return     Measures
+	 */
+	Stats stats() const;
+
+	/*! \brief      Waits for the next frame, then updates and draws it
+	 *  \return     OK if success,
+	 *             ERR if a widget failed to draw
+	 */
+	int frame();
+
+private:
+	/*! \brief      Waits for the start of the next frame
+	 *  \param      earliest    Earliest start
+	 *  \param      latest      Latest start
+	 */
+	void wait(std::chrono::steady_clock::time_point earliest, std::chrono::steady_clock::time_point latest);
+
+	/*! \brief      Adapts the priority and the interval to a frame
+	 *  \details    Must be called with _mutex held.
+	 *  \param      work    Time of the frame
+	 *  \param      idle    Frame drew nothing
+	 */
+	void adapt(std::chrono::microseconds work, bool idle);
+
+	mutable std::mutex _mutex;					/*!< Guards the settings and the measures */
+	NTScreen *_screen;							/*!< Screen to draw */
+	std::function<void()> _update;				/*!< Update function */
+	NTTimerWheel *_timers;						/*!< Timers of the frames (nullptr - none) */
+	NTAnimator *_animator;						/*!< Tweens of the frames (nullptr - none) */
+	std::chrono::microseconds _target;			/*!< Target frame time */
+	std::chrono::microseconds _idle;			/*!< Longest frame time while idle */
+	std::chrono::steady_clock::time_point _last;	/*!< Start of the last frame */
+	int _input;									/*!< Watched descriptor (-1 - none) */
+	int _pipe[2];								/*!< Wake pipe: read end, write end */
+	int _level;									/*!< Priority level of the next frame */
+	int _over;									/*!< Frames over the budget in a row */
+	int _under;									/*!< Frames well within the budget in a row */
+	Stats _stats;								/*!< Measures of the last frame */
+};
+
+#endif // _NTFRAMESCHEDULER_H_
@@ -0,0 +1,60 @@
+/*! \file       ntframesink.h
+ *  \brief      NT Frame sink interface (header file).
+ *  \details    Contains the NTFrameSink interface of the outputs that take
+ *              composed frames: terminals, recordings and streams.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTFRAMESINK_H_
+#define _NTFRAMESINK_H_
+
+/*! \brief  Standard size types */
+#include <cstddef>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+
+/*! \class      NTFrameSink
+ *  \brief      Output of composed frames.
+ *  \details    A sink keeps the frame it sent last and sends only the cells
+ *              that differ from it, so the same frame can go to several
+ *              sinks, each at its own pace. A frame of another size than the
+ *              last one is sent whole. Cells of the frame that were not
+ *              written (NTF_NONE) are sent as blanks.
+ */
+class NTFrameSink
+{
+public:
+	/*! \brief  Virtual destructor to allow proper inheritance */
+	virtual ~NTFrameSink() = default;
+
+	/*! \brief      Sends the changes of a frame
+	 *  \param      frame   Composed frame (its area is the screen)
+	 *  \return     NT_OK if success, NT_ERR otherwise
+	 */
+	virtual int present(const NTFrameBuffer &frame) = 0;
+
+	/*! \brief  Sends the whole next frame (the output was lost or cleared) */
+	virtual void invalidate() = 0;
+
+	/*! \brief      Gets the number of cells sent by the last present()
+	 *  \return     Number of cells
+	 */
+	virtual size_t written() const = 0;
+
+	/*! \brief      Defines a color pair used by the next frames
+	 *  \details    Called by sources that carry their own palette (recordings
+	 *              and streams); a sink on the terminal that drew the frames
+	 *              has the pairs already.
+	 *  \param      pair        Color pair
+	 *  \param      foreground  Foreground color (-1 - default)
+	 *  \param      background  Background color (-1 - default)
+	 */
+	virtual void define(short pair, short foreground, short background) { (void)pair; (void)foreground; (void)background; }
+};
+
+#endif // _NTFRAMESINK_H_
@@ -8,21 +8,60 @@
 
 #include "ntgraphicobject.h"
 
+/*! \brief  Spatial index */
+#include "ntspatialindex.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+namespace {
+	// Writes a glyph of a width and its attrs into a frame buffer cell
+	void store(NTFrameBuffer &layer, int x, int y, const wchar_t *wch, int width, attr_t attributes,
+			   short color_pair, bool glyph, bool attrs)
+	{
+		NTFrameBuffer::Cell *cell = layer.at(x, y);
+		if (glyph) {
+			std::copy(wch, wch + CCHARW_MAX, cell->text);
+			cell->flags = (cell->flags & ~(NTF_WIDE | NTF_CONTINUATION)) | NTF_GLYPH;
+		}
+		if (attrs) {
+			cell->attr = attributes;
+			cell->pair = color_pair;
+			cell->flags |= NTF_ATTR;
+		}
+
+		// A wide glyph covers the next cell too
+		if (glyph && width == 2) {
+			cell->flags |= NTF_WIDE;
+			NTFrameBuffer::Cell *next = layer.at(x + 1, y);
+			if (next) {
+				*next = NTFrameBuffer::empty();
+				next->attr = cell->attr;
+				next->pair = cell->pair;
+				next->flags = NTF_GLYPH | NTF_CONTINUATION | (cell->flags & NTF_ATTR);
+			}
+		}
+	}
+}
+
 // Default constructor
-NTGraphicObject::NTGraphicObject(NTObject* parent, const std::string& name)
-	: NTObject(parent, name), _x(0), _y(0),
+NTGraphicObject::NTGraphicObject(NTObject* parent, const std::string& name,
+								 std::pmr::memory_resource *resource)
+	: NTObject(parent, name, resource), _x(0), _y(0),
 	_colorPair(0), _attr(0), _ntattr(NTA_NONE),
-	_changed(true) {}
+	_changed(true), _occlusion(nullptr), _depth(0), _window(nullptr), _layer(nullptr), _index(nullptr) {}
 
 //Parameterized constructor
 NTGraphicObject::NTGraphicObject(NTObject* parent, const std::string& name,
-			   int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr)
-	: NTObject(parent, name), _x(x), _y(y),
+			   int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			   std::pmr::memory_resource *resource)
+	: NTObject(parent, name, resource), _x(x), _y(y),
 	_colorPair(colorPair), _attr(attr), _ntattr(ntattr),
-	_changed(true) {}
+	_changed(true), _occlusion(nullptr), _depth(0), _window(nullptr), _layer(nullptr), _index(nullptr) {}
 
-// Copy constructor
+// Copy constructor (the copy is not in the spatial index)
 NTGraphicObject::NTGraphicObject(const NTGraphicObject& other)
+	: _occlusion(nullptr), _depth(0), _window(nullptr), _layer(nullptr), _index(nullptr)
 {
 	std::lock_guard<std::mutex> lock(other._mutex);
 	NTObject::operator=(other);
@@ -36,7 +75,11 @@ NTGraphicObject::NTGraphicObject(const NTGraphicObject& other)
 }
 
 // Destructor
-NTGraphicObject::~NTGraphicObject() = default;
+NTGraphicObject::~NTGraphicObject()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_index) _index->erase(this);
+}
 
 // Assignment operator
 NTGraphicObject& NTGraphicObject::operator=(const NTGraphicObject& other)
@@ -53,6 +96,7 @@ NTGraphicObject& NTGraphicObject::operator=(const NTGraphicObject& other)
 		_attr = other._attr;
 		_ntattr = other._ntattr;
 		_changed = other._changed;
+		placed();
 	}
 	//notifyObservers();
 	return *this;
@@ -64,6 +108,7 @@ void NTGraphicObject::setx(int x)
 	std::lock_guard<std::mutex> lock(_mutex);
 	_x = x;
 	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -80,6 +125,7 @@ void NTGraphicObject::sety(int y)
 	std::lock_guard<std::mutex> lock(_mutex);
 	_y = y;
 	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -96,6 +142,8 @@ void NTGraphicObject::setPosition(int x, int y)
 	std::lock_guard<std::mutex> lock(_mutex);
 	_x = x;
 	_y = y;
+	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -151,5 +199,287 @@ unsigned char NTGraphicObject::ntattr() const
 bool NTGraphicObject::isChanged() const
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	return dirty();
+}
+
+// Gets the area covered by the object
+nt::Rect NTGraphicObject::bounds() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return area();
+}
+
+// Gets the size the object needs for its content
+nt::Size NTGraphicObject::measure() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return measured();
+}
+
+// Places the object in an area assigned by a layout
+bool NTGraphicObject::setGeometry(const nt::Rect &rect)
+{
+	setPosition(rect.x, rect.y);
+	return false;
+}
+
+// Forces a full redraw on the next draw()
+void NTGraphicObject::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_changed = true;
+}
+
+// Base object has no size
+nt::Rect NTGraphicObject::area() const
+{
+	return {_x, _y, 0, 0};
+}
+
+// Content size is the size of the area by default
+nt::Size NTGraphicObject::measured() const
+{
+	nt::Rect rect = area();
+	return {rect.width, rect.height};
+}
+
+// Objects redraw all of their area by default
+nt::Rect NTGraphicObject::dirtyArea() const
+{
+	return area();
+}
+
+// Objects need drawing when changed
+bool NTGraphicObject::dirty() const
+{
 	return _changed;
 }
+
+// Objects ignore screen resizes by default
+void NTGraphicObject::screenResized(int, int)
+{
+}
+
+// Objects are not opaque by default
+bool NTGraphicObject::opaque() const
+{
+	return false;
+}
+
+// Objects draw without ncurses into a frame buffer by default
+bool NTGraphicObject::serial() const
+{
+	return false;
+}
+
+// Updates the spatial index after a position or size change
+void NTGraphicObject::placed()
+{
+	if (_index) _index->move(this, area());
+}
+
+// Draws another object clipped by an occlusion map
+int NTGraphicObject::drawClipped(NTGraphicObject *object, const NTOcclusion *occlusion, int depth,
+								 WINDOW *window, NTFrameBuffer *layer)
+{
+	{
+		std::lock_guard<std::mutex> lock(object->_mutex);
+		object->_occlusion = occlusion;
+		object->_depth = depth;
+		object->_window = window;
+		object->_layer = layer;
+	}
+	int result = object->draw();
+	{
+		std::lock_guard<std::mutex> lock(object->_mutex);
+		object->_occlusion = nullptr;
+		object->_window = nullptr;
+		object->_layer = nullptr;
+		object->_changed = false;
+	}
+	return result;
+}
+
+// Gets the window the object draws into
+WINDOW *NTGraphicObject::window() const
+{
+	return _window ? _window : stdscr;
+}
+
+// Shows the drawn cells
+void NTGraphicObject::present()
+{
+	if (!_window && !_layer) refresh();
+}
+
+// Shifts the cells of a screen area up or down
+bool NTGraphicObject::shiftArea(const nt::Rect &area, int rows)
+{
+	// Layers are not shifted; a screen clears its damaged cells before the widgets draw
+	if (_layer || _occlusion) return false;
+
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Only an area that is whole on the screen can be shifted
+	if (area.x < 0 || area.y < 0 || area.width <= 0 || area.height <= 0 ||
+		area.x + area.width > max_x || area.y + area.height > max_y) return false;
+
+	WINDOW *parent = window();
+	WINDOW *region = is_pad(parent) ? subpad(parent, area.height, area.width, area.y, area.x)
+									: derwin(parent, area.height, area.width, area.y, area.x);
+	if (!region) return false;
+
+	if (!is_pad(parent)) idlok(parent, TRUE);	// let ncurses use the scroll region of the terminal
+	scrollok(region, TRUE);
+	int result = wscrl(region, rows);
+	wsyncup(region);
+	delwin(region);
+	return result != ERR;
+}
+
+// Clears one cell to an empty space
+void NTGraphicObject::clearCell(int y, int x)
+{
+	if (_layer) {
+		NTFrameBuffer::Cell *cell = _layer->at(x, y);
+		if (cell) *cell = NTFrameBuffer::blank();
+		return;
+	}
+	mvwaddch(window(), y, x, ' ');
+}
+
+// Draws one glyph with the nt attrs applied
+int NTGraphicObject::drawGlyph(int y, int x, const char *glyph, size_t length, unsigned char style, int width)
+{
+	// Cell hidden by an opaque object above or not damaged
+	if (_occlusion && !_occlusion->visible(x, y, _depth)) return OK;
+
+	// Get the cell: from the frame buffer or from the window
+	WINDOW *target = window();
+	NTFrameBuffer::Cell *stored = nullptr;
+	int result = OK;
+	cchar_t cell;
+	wchar_t wch[CCHARW_MAX + 1] = {0};
+	attr_t attributes = A_NORMAL;
+	short color_pair = 0;
+	if (_layer) {
+		stored = _layer->at(x, y);
+		if (!stored) return OK;		// outside the layer of the object
+		std::copy(stored->text, stored->text + CCHARW_MAX, wch);
+		attributes = stored->attr;
+		color_pair = stored->pair;
+	} else {
+		// Move cursor to the x, y - position to get the attrs
+		result = wmove(target, y, x);
+		win_wch(target, &cell);
+		getcchar(&cell, wch, &attributes, &color_pair, nullptr);
+	}
+	attributes &= ~A_COLOR;
+
+	bool space = (length == 1 && glyph[0] == ' ');
+
+	// If attrs for the text then...
+	bool attrs = false;
+	if( (_ntattr & NTA_TEXT_ATTR) && !space ){
+		color_pair = _colorPair;
+		attributes = _attr;
+		attrs = true;
+	}
+
+	// If attr for the space then...
+	if( (_ntattr & NTA_SPACE_ATTR) && space ){
+		color_pair = _colorPair;
+		attributes = _attr;
+		attrs = true;
+	}
+
+	// Style plane overrides the color pair of the cell
+	if( style ){
+		color_pair = style;
+		attributes = _attr;
+		attrs = true;
+	}
+
+	// Prepare glyph to print in terminal (transparent space keeps the cell content)
+	bool written = !(space && (_ntattr & NTA_SPACE_TRANSPARENT));
+	if( written ){
+		size_t count = 0;
+		size_t offset = 0;
+		while (offset < length && count < CCHARW_MAX) {
+			char32_t cp;
+			offset += nt::decode(glyph + offset, length - offset, cp);
+			wch[count++] = static_cast<wchar_t>(cp);
+		}
+		wch[count] = L'\0';
+	}
+
+	// Transparent space with no attrs: the cell stays (writing back the glyph read from the right half of a wide glyph would move it)
+	if (!written && !attrs && !stored) return result;
+
+	// Frame buffer: keep what was written, the rest shows the cell below
+	if (stored) {
+		store(*_layer, x, y, wch, width, attributes, color_pair, written, attrs);
+		return OK;
+	}
+
+	// Print glyph with the attrs, color, background color
+	setcchar(&cell, wch, attributes, color_pair, nullptr);
+	wadd_wch(target, &cell);
+
+	return result;
+}
+
+// Draws the visible columns of one text line
+int NTGraphicObject::drawText(int y, int x, std::string_view text, const nt::TextLayout &layout, int max_x,
+							  const unsigned char *style)
+{
+	return drawColumns(y, x, text, layout, 0, layout.columns, max_x, style);
+}
+
+// Draws the visible part of a column range of one text line
+int NTGraphicObject::drawColumns(int y, int x, std::string_view text, const nt::TextLayout &layout,
+								 int first, int last, int max_x, const unsigned char *style)
+{
+	int result = NT_OK;
+
+	// Get the start column and the end column
+	int visible_hstart = std::max(first, 0);
+	int visible_hend = std::min(last, static_cast<int>(layout.columns));
+
+	if(x + visible_hstart < 0) {
+		visible_hstart = 0 - x;
+	}
+
+	if(visible_hend + x > max_x) {
+		visible_hend = max_x - x;
+	}
+
+	// If no visible columns left
+	if (visible_hend <= visible_hstart) {
+		return NT_ERR_INVISIBLE_X;
+	}
+
+	// Whole row hidden by opaque objects above
+	if (_occlusion && _occlusion->hidden({x + visible_hstart, y, visible_hend - visible_hstart, 1}, _depth)) {
+		return result;
+	}
+
+	// Draw visible portion
+	for(int col = visible_hstart; col < visible_hend; col++){
+		nt::TextColumn column = layout.column(col);
+
+		// Wide glyph cut by the clipping edge or half hidden
+		if (column.length == 0 || col + column.width > visible_hend ||
+			(_occlusion && column.width > 1 && !_occlusion->visible(x + col + 1, y, _depth))) {
+			if (drawGlyph(y, x + col, " ", 1) == ERR) result = ERR;
+			continue;
+		}
+
+		if (drawGlyph(y, x + col, text.data() + column.offset, column.length,
+					  style ? style[col] : 0, column.width) == ERR) result = ERR;
+		col += column.width - 1;
+	}
+
+	return result;
+}
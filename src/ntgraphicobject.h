@@ -16,12 +16,22 @@
 #include "nttypes.h"
 /*! \brief  Base NT object */
 #include "ntobject.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+/*! \brief  Occlusion map */
+#include "ntocclusion.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
 
 #define NTA_NONE				0			/*!< No attr */
 #define NTA_TEXT_ATTR			(1 << 0)	/*!< Text attribute override flag */
 #define NTA_SPACE_ATTR			(1 << 1)	/*!< Space attribute override flag */
 #define NTA_SPACE_TRANSPARENT	(1 << 2)	/*!< Space transparent flag */
 
+class NTSpatialIndex;
+class NTScreen;
+class NTTileRenderer;
+
 /*! \class      NTGraphicObject
  *  \brief      Graphic object class for NT system.
  *  \details    Represents an base graphic object with position, color attributes and transparency support.
@@ -32,8 +42,10 @@ public:
 	/*!	\brief		Default constructor
 	 *	\param		parent	Pointer to the parent object (default: nullptr)
 	 *	\param		name	Label name (default: empty string)
+	 *	\param		resource	Memory resource for the name and payload (default: heap)
 	 */
-	NTGraphicObject(NTObject* parent = nullptr, const std::string& name = "");
+	NTGraphicObject(NTObject* parent = nullptr, const std::string& name = "",
+					std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	/*!	\brief		Parameterized constructor
 	 *	\param		parent		Pointer to the parent object
@@ -43,12 +55,14 @@ public:
 	 *	\param		colorPair	Color pair to draw from the palette
 	 *	\param		attr		Attr of Graphic Object
 	 *	\param		ntattr		nt attr of Graphic Object
+	 *	\param		resource	Memory resource for the name and payload (default: heap)
 	 */
 	NTGraphicObject(NTObject* parent, const std::string& name,
 					int x, int y,
 					unsigned char colorPair,
 					chtype attr,
-					unsigned char ntattr);
+					unsigned char ntattr,
+					std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	/*!	\brief		Copy constructor
 	 *	\param		other	Reference to source NTLabel object
@@ -126,10 +140,187 @@ public:
 	 */
 	bool isChanged() const;
 
+	/*! \brief      Gets the area covered by the object
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect bounds() const;
+
+	/*! \brief      Gets the size the object needs for its content
+	 *  \details    Used by NTLayout: text length of a label, size of an image.
+	 *  \return     Size in cells
+	 */
+	nt::Size measure() const;
+
+	/*! \brief      Places the object in an area assigned by a layout
+	 *  \details    The base object only moves to the corner of the area;
+	 *              objects with a settable size take the size too.
+	 *  \param      rect    Assigned area
+	 *  \return     true if the object took the size of the area
+	 */
+	virtual bool setGeometry(const nt::Rect &rect);
+
+	/*! \brief      Forces a full redraw on the next draw()
+	 *  \details    Used when the cells of the object were overwritten.
+	 */
+	virtual void invalidate();
+
+	/*! \brief      Notifies the object of a new size of its screen
+	 *  \details    Called by NTScreen before the first frame of the new
+	 *              size, without any mutex held. Does nothing by default.
+	 *  \param      width   Screen width
+	 *  \param      height  Screen height
+	 */
+	virtual void screenResized(int width, int height);
+
 	// Virtual methot to draw (must be override)
 	virtual int draw() = 0;
 
 protected:
+	/*! \brief      Gets the area covered by the object
+	 *  \details    Must be called with _mutex held. Objects with a size
+	 *              override it; the base object has no size.
+	 *  \return     Position and size in cells
+	 */
+	virtual nt::Rect area() const;
+
+	/*! \brief      Gets the area the next draw() repaints
+	 *  \details    Must be called with _mutex held. NTScreen clears these
+	 *              cells before the object draws, so draw() must repaint
+	 *              every cell of the area, not only the cells it knows
+	 *              changed. Objects that redraw only a part of themselves
+	 *              override it (the default is the whole object).
+	 *  \return     Position and size in cells
+	 */
+	virtual nt::Rect dirtyArea() const;
+
+	/*! \brief      Gets the size the object needs for its content
+	 *  \details    Must be called with _mutex held. The size of area() by
+	 *              default.
+	 *  \return     Size in cells
+	 */
+	virtual nt::Size measured() const;
+
+	/*! \brief      Checks if the object needs drawing
+	 *  \details    Must be called with _mutex held. Containers also check
+	 *              their children.
+	 *  \return     true if changed, false otherwise
+	 */
+	virtual bool dirty() const;
+
+	/*! \brief      Checks if the object overwrites every cell of its area
+	 *  \details    Must be called with _mutex held. Opaque objects hide
+	 *              the objects below them from NTScreen.
+	 *  \return     true if opaque, false otherwise
+	 */
+	virtual bool opaque() const;
+
+	/*! \brief      Checks if draw() calls ncurses even with a frame buffer
+	 *  \details    Must be called with _mutex held. NTTileRenderer draws
+	 *              such objects on its own thread, not on the workers.
+	 *  \return     true if serial, false otherwise
+	 */
+	virtual bool serial() const;
+
+	/*! \brief      Updates the spatial index after a position or size change
+	 *  \details    Must be called with _mutex held.
+	 */
+	void placed();
+
+	/*! \brief      Draws another object clipped by an occlusion map
+	 *  \details    Used by containers to draw their children. Must be
+	 *              called without the _mutex of the child held.
+	 *  \param      object      Object to draw
+	 *  \param      occlusion   Occlusion map
+	 *  \param      depth       Depth of the object in the map
+	 *  \param      window      Window to draw into (nullptr - stdscr)
+	 *  \param      layer       Frame buffer to draw into instead of the
+	 *                          window (nullptr - none); the window only
+	 *                          gives the screen size then
+	 *  \return     Result of the draw() of the object
+	 */
+	static int drawClipped(NTGraphicObject *object, const NTOcclusion *occlusion, int depth,
+						   WINDOW *window = nullptr, NTFrameBuffer *layer = nullptr);
+
+	/*! \brief      Gets the window the object draws into
+	 *  \details    Must be called with _mutex held. Containers with a
+	 *              window of their own (see NTPanel) pass it to the children;
+	 *              coordinates are relative to that window.
+	 *  \return     Window set by the container or stdscr
+	 */
+	WINDOW *window() const;
+
+	/*! \brief      Shows the drawn cells
+	 *  \details    Must be called with _mutex held. Refreshes the terminal
+	 *              when the object was drawn into stdscr; a container with a
+	 *              window of its own (or a renderer with a frame buffer)
+	 *              composites it itself.
+	 */
+	void present();
+
+	/*! \brief      Shifts the cells of a screen area up or down
+	 *  \details    Must be called with _mutex held. Uses wscrl() on a
+	 *              subwindow, which ncurses turns into a terminal scroll
+	 *              region where the terminal supports it. Only an area that
+	 *              is whole on the screen is shifted. Cells of a frame buffer
+	 *              and widgets drawn by a screen (which clears the damaged
+	 *              cells first) are never shifted.
+	 *  \param      area    Screen area
+	 *  \param      rows    Rows to shift up (negative - down)
+	 *  \return     true if shifted, false if the area must be redrawn
+	 */
+	bool shiftArea(const nt::Rect &area, int rows);
+
+	/*! \brief      Clears one cell to an empty space
+	 *  \details    Must be called with _mutex held.
+	 *  \param      y       Y coordinate of the cell
+	 *  \param      x       X coordinate of the cell
+	 */
+	void clearCell(int y, int x);
+
+	/*! \brief      Draws one glyph with the nt attrs applied
+	 *  \details    Must be called with _mutex held.
+	 *  \param      y       Y coordinate of the cell
+	 *  \param      x       X coordinate of the cell
+	 *  \param      glyph   Pointer to the UTF-8 bytes of the glyph
+	 *  \param      length  Glyph length in bytes
+	 *  \param      style   Color pair of the cell from a style plane (0 - none)
+	 *  \param      width   Glyph width in columns (from the layout of the text)
+	 *  \return     OK if success, ERR if the cell can not be addressed
+	 */
+	int drawGlyph(int y, int x, const char *glyph, size_t length, unsigned char style = 0, int width = 1);
+
+	/*! \brief      Draws the visible columns of one text line
+	 *  \details    Must be called with _mutex held. Wide glyphs cut by
+	 *              the left or right edge are replaced with a space.
+	 *  \param      y       Y coordinate of the line
+	 *  \param      x       X coordinate of the first column (may be negative)
+	 *  \param      text    UTF-8 text of the line
+	 *  \param      layout  Cached column map of the text
+	 *  \param      max_x   Terminal width
+	 *  \param      style   Per-column color pairs (nullptr - none)
+	 *  \return     OK if success, NT_ERR_INVISIBLE_X if no column is visible,
+	 *              ERR if other error occurred
+	 */
+	int drawText(int y, int x, std::string_view text, const nt::TextLayout &layout, int max_x,
+				 const unsigned char *style = nullptr);
+
+	/*! \brief      Draws the visible part of a column range of one text line
+	 *  \details    Must be called with _mutex held. Same as drawText() but only
+	 *              the columns [first, last) of the text are drawn.
+	 *  \param      y       Y coordinate of the line
+	 *  \param      x       X coordinate of the first column (may be negative)
+	 *  \param      text    UTF-8 text of the line
+	 *  \param      layout  Cached column map of the text
+	 *  \param      first   First text column to draw
+	 *  \param      last    Text column after the last one to draw
+	 *  \param      max_x   Terminal width
+	 *  \param      style   Per-column color pairs (nullptr - none)
+	 *  \return     OK if success, NT_ERR_INVISIBLE_X if no column is visible,
+	 *              ERR if other error occurred
+	 */
+	int drawColumns(int y, int x, std::string_view text, const nt::TextLayout &layout,
+					int first, int last, int max_x, const unsigned char *style = nullptr);
+
 	mutable std::mutex _mutex;	/*!< Thread-safe mutex */
 	int _x;						/*!< X coordinate */
 	int _y;						/*!< Y coordinate */
@@ -137,5 +328,17 @@ protected:
 	chtype _attr;				/*!< ncurses attr*/
 	unsigned char _ntattr;		/*!< nt attr*/
 	bool _changed;				/*!< Changed flag */
+	const NTOcclusion *_occlusion;	/*!< Occlusion map of the frame being drawn (nullptr - none) */
+	int _depth;					/*!< Depth of the object in the frame being drawn */
+	WINDOW *_window;			/*!< Window of the frame being drawn (nullptr - stdscr) */
+	NTFrameBuffer *_layer;		/*!< Frame buffer of the frame being drawn (nullptr - window) */
+
+private:
+	friend class NTSpatialIndex;
+	friend class NTScreen;
+	friend class NTTileRenderer;
+	friend class NTAnimator;
+
+	NTSpatialIndex *_index;		/*!< Spatial index the object is in (nullptr - none) */
 };
 #endif // _NTGRAPHICOBJECT_H_
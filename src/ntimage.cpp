@@ -15,7 +15,8 @@ NTImage::NTImage(NTObject* parent, const std::string& name)
 	0,								// Color pair to draw from the palette
 	A_NORMAL,						// attr
 	NTA_NONE),						// nattr
-	_image({{""}, 0, 0}),			// image
+	_source(NTImageData::intern({{""}, 0, 0})),	// image
+	_loaded(true),					// image data is ready
 	_width(0), _height(0)			// width, height
 {
 	std::lock_guard<std::mutex> lock(_mutex);
@@ -25,18 +26,42 @@ NTImage::NTImage(NTObject* parent, const std::string& name)
 // Parameterized constructor
 NTImage::NTImage(NTObject *parent, const std::string& name,
 			   const struct nt::Image& image,
-			   int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr)
+			   int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			   std::pmr::memory_resource *resource)
 	: NTGraphicObject(parent, name,	// parent, name
 	x, y,							// x, y coordinate of the left-top corner of the image
 	colorPair,						// Color pair to draw from the palette
 	attr,							// attr
-	ntattr),						// ntattr
-	_image(image)					// image
+	ntattr,							// ntattr
+	resource),						// memory resource
+	_source(NTImageData::intern(image)),	// shared image
+	_loaded(true),					// image data is ready
+	_width(image.width), _height(image.height)	// width, height
 {
 	std::lock_guard<std::mutex> lock(_mutex);
 	//notifyObservers();
 }
 
+// Parameterized constructor with an image source
+NTImage::NTImage(NTObject *parent, const std::string& name,
+			   std::shared_ptr<NTImageSource> source,
+			   int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			   std::pmr::memory_resource *resource)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the left-top corner of the image
+	colorPair,						// Color pair to draw from the palette
+	attr,							// attr
+	ntattr,							// ntattr
+	resource),						// memory resource
+	_source(source ? std::move(source) : NTImageData::intern({{}, 0, 0})),	// source
+	_loaded(false),					// source is loaded on first draw
+	_width(_source->width()), _height(_source->height())	// width, height (measured again on load)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	placed();
+	//notifyObservers();
+}
+
 // Copy constructor
 NTImage::NTImage(const NTImage& other)
 	: NTGraphicObject(other.parent(), other.name(),	// parent, name
@@ -44,9 +69,12 @@ NTImage::NTImage(const NTImage& other)
 	other._colorPair,								// Color pair to draw from the palette
 	other._attr,									// attr
 	other._ntattr),									// ntattr
-	_image(other._image)							// image
+	_width(other._width), _height(other._height)	// width, height
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	std::lock_guard<std::mutex> other_lock(other._mutex);
+	_source = other._source;	// shared, not copied
+	_loaded = other._loaded;
 	//notifyObservers();
 }
 
@@ -62,13 +90,17 @@ NTImage& NTImage::operator=(const NTImage& other)
 		std::lock(lock1, lock2);
 
 		NTObject::operator=(other);
-		_image = other._image;
+		_source = other._source;	// shared, not copied
+		_loaded = other._loaded;
+		_width = other._width;
+		_height = other._height;
 		_x = other._x;
 		_y = other._y;
 		_colorPair = other._colorPair;
 		_attr = other._attr;
 		_ntattr = other._ntattr;
 		_changed = true;
+		placed();
 	}
 	//notifyObservers();
 	return *this;
@@ -78,16 +110,42 @@ NTImage& NTImage::operator=(const NTImage& other)
 void NTImage::setImage(const struct nt::Image& image)
 {
 	std::lock_guard<std::mutex> lock(_mutex);
-	_image = image;
+	_source = NTImageData::intern(image);
+	_loaded = true;
+	_width = image.width;
+	_height = image.height;
+	placed();
 	_changed = true;
 	//notifyObservers();
 }
 
 // Gets the image data
-const struct nt::Image& NTImage::image() const
+struct nt::Image NTImage::image() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	const NTImageData *data = dynamic_cast<const NTImageData *>(_source.get());
+	if (!data) return {{}, 0, 0};
+	return data->image();
+}
+
+// Sets the image source
+void NTImage::setSource(std::shared_ptr<NTImageSource> source)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_source = source ? std::move(source) : NTImageData::intern({{}, 0, 0});
+	_loaded = false;
+	_width = _source->width();
+	_height = _source->height();
+	placed();
+	_changed = true;
+	//notifyObservers();
+}
+
+// Gets the image source
+std::shared_ptr<NTImageSource> NTImage::source() const
 {
 	std::lock_guard<std::mutex> lock(_mutex);
-	return _image;
+	return _source;
 }
 
 // Sets the image width
@@ -96,6 +154,7 @@ void NTImage::setWidth(unsigned int width)
 	std::lock_guard<std::mutex> lock(_mutex);
 	_width = width;
 	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -112,6 +171,7 @@ void NTImage::setHeight(unsigned int height)
 	std::lock_guard<std::mutex> lock(_mutex);
 	_height = height;
 	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -122,45 +182,64 @@ unsigned int NTImage::height() const
 	return _height;
 }
 
+// Gets the area covered by the image
+nt::Rect NTImage::area() const
+{
+	return {_x, _y, static_cast<int>(_width), static_cast<int>(_height)};
+}
+
+// Image is opaque if every row fills the width and spaces are not transparent
+bool NTImage::opaque() const
+{
+	if ((_ntattr & NTA_SPACE_TRANSPARENT) || !_loaded || _source->height() < _height) return false;
+	for (unsigned int y = 0; y < _height; y++) {
+		if (_source->layout(y).columns < _width) return false;
+	}
+	return true;
+}
+
 // Draw the image
 int NTImage::draw()
 {
 	std::lock_guard<std::mutex> lock(_mutex);
 	int result = NT_OK;
 
+	// Load the source on first draw
+	if (!_loaded) {
+		if (_source->load() != NT_OK) return NT_ERR;
+		_width = _source->width();
+		_height = _source->height();
+		_loaded = true;
+		placed();
+	}
+
 	// Get terminal dimensions
 	int max_y, max_x;
-	getmaxyx(stdscr, max_y, max_x);
+	getmaxyx(window(), max_y, max_x);
 
 	// Check if Y-position is out of bounds or no need to draw
-	if ( _y+_height < 0 || _y > max_y ) {
+	if ( _y + static_cast<int>(_height) <= 0 || _y >= max_y ) {
 		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
 	}
 
 	// Check if X-position is out of bounds or no need to draw
-	if ( _x+_width < 0 || _x > max_x) {
+	if ( _x + static_cast<int>(_width) <= 0 || _x >= max_x) {
 		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
 	}
 
 	// Position (Y, X) completely out of bounds
 	if(NT_OK != result) return result;
 
-	// Get the start of character and length
+	// Get the start of row and length
 	int visible_vstart = 0;
 	int visible_vlength = 0;
-	int visible_hstart = 0;
-	int visible_hlength = 0;
 
 	// Check if visible y-position
 	if(_y < 0) {
 		visible_vstart = 0 - _y;
 	}
 
-	visible_vlength = std::min({
-		static_cast<int>(_height),
-		static_cast<int>(_image.height),
-		static_cast<int>(_image.img.size())
-	});
+	visible_vlength = std::min(static_cast<int>(_height), static_cast<int>(_source->height()));
 
 	if(visible_vlength + _y > max_y) {
 		visible_vlength = max_y - _y;
@@ -171,76 +250,14 @@ int NTImage::draw()
 
 	// Draw visible portion
 	for(int y = visible_vstart; y < visible_vlength; y++){
-		//
-		const std::string& line = _image.img[y];
-
-		// If no visible characters left
-		if (visible_vlength <= 0) {
-			result |=  NT_ERR_INVISIBLE_Y;
-		}
-
-		// Check if visible x-position
-		if(_x < 0) {
-			visible_hstart = 0 - _x;
-		}
-
-		visible_hlength = line.length();
-
-		if(visible_hlength + _x > max_x) {
-			visible_hlength = max_x - _x;
-		}
-
-		// If no visible characters left
-		if (visible_hlength <= 0) {
-			result |=  NT_ERR_INVISIBLE_X;
-			continue;
-		}
-
-		//
-		for(int x = visible_hstart; x < visible_hlength; x++){
-			// Move cursor to the x, y - position to get the attrs
-			result = move(_y + y, _x + x);
-
-			// Get the attrs in the current cursor position
-			chtype ch = inch();					// Get character and attrs
-			int color_pair = PAIR_NUMBER(ch);	// Get color pair
-			int attributes = ch & A_ATTRIBUTES;	// Get attr
-
-			// If attrs for the text then...
-			if( _ntattr & NTA_TEXT_ATTR ){
-				if(line.at(x) != ' '){
-					color_pair = _colorPair;
-					attributes = _attr;
-				}
-			}
-
-			// If attr for the space then...
-			if( _ntattr & NTA_SPACE_ATTR ){
-				if(line.at(x) == ' '){
-					color_pair = _colorPair;
-					attributes = _attr;
-				}
-			}
-
-			// Prepare character to print in terminal
-			if( _ntattr & NTA_SPACE_TRANSPARENT ){
-				if(line.at(x) == ' '){
-					ch = inch();
-				}else{
-					ch = line.at(x);
-				}
-			}else{
-				ch = line.at(x);
-			}
-
-			// Set the attrs, color, background color
-			result = attron(COLOR_PAIR(color_pair) | attributes);
-
-			// Print character
-			result = addch(ch);
-
-			// Unset attrs
-			result = attroff(COLOR_PAIR(color_pair) | attributes);
+		// Draw visible columns of the row
+		int line_result = drawText(_y + y, _x, _source->row(y), _source->layout(y), max_x,
+								   _source->style(y));
+
+		if (line_result == ERR) {
+			result = ERR;
+		} else if (result != ERR) {
+			result |= line_result;
 		}
 	}
 
@@ -250,7 +267,7 @@ int NTImage::draw()
 	}
 
 	// No fatal error occured
-	refresh();
+	present();
 	_changed = false;
 	return result;
 }
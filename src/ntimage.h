@@ -21,6 +21,8 @@
 #include <algorithm>
 /*! \brief  Mutex library */
 #include <mutex>
+/*! \brief  Smart pointers */
+#include <memory>
 
 /*!	\brief	ncurses library */
 #include <ncurses.h>
@@ -31,9 +33,16 @@
 /*! \brief  Base NT graphic object */
 #include "ntgraphicobject.h"
 
+/*! \brief  Image source interface */
+#include "ntimagesource.h"
+/*! \brief  Shared image payload */
+#include "ntimagedata.h"
+
 /*! \class      NTImage
  *  \brief      Image class for NT system.
  *  \details    Represents an image object with position, color attributes and transparency support.
+ *              The image payload is shared and immutable: widgets showing equal
+ *              images share one NTImageData, and copying a widget is O(1).
  *  \extends    NTGraphicObject
  */
 class NTImage : public NTGraphicObject
@@ -54,10 +63,30 @@ public:
 	 *	\param		colorPair	Color pair to draw from the palette
 	 *	\param		attr		Attr for the image
 	 *	\param      ntattr		nt attr for the image
+	 *	\param		resource	Memory resource for the name (default: heap)
 	 */
 	NTImage(NTObject *parent, const std::string& name,
 			const struct nt::Image& image,
-			int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr);
+			int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+	/*! \brief      Parameterized constructor with an image source
+	 *  \details    The size is taken from the source; the source is loaded
+	 *              (and measured again) on the first draw.
+	 *  \param      parent      Pointer to the parent object
+	 *  \param      name        Image name
+	 *  \param      source      Shared image source (e.g. a frame of NTImageFile)
+	 *  \param      x           X coordinate of the image
+	 *  \param      y           Y coordinate of the image
+	 *	\param		colorPair	Color pair to draw from the palette
+	 *	\param		attr		Attr for the image
+	 *	\param      ntattr		nt attr for the image
+	 *	\param		resource	Memory resource for the name (default: heap)
+	 */
+	NTImage(NTObject *parent, const std::string& name,
+			std::shared_ptr<NTImageSource> source,
+			int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	/*! \brief  Destructor */
 	~NTImage();
@@ -79,9 +108,24 @@ public:
 	void setImage(const struct nt::Image& image);
 
 	/*! \brief      Gets the image data
-	 *  \return     Constant reference to the image data vector
+	 *  \details    Returns a copy: setImage() and setSource() release the
+	 *              shared data the image was drawn from.
+	 *  \return     Image data (empty if the image is drawn from a source
+	 *              other than NTImageData)
+	 */
+	struct nt::Image image() const;
+
+	/*! \brief      Sets the image source
+	 *  \details    The size is taken from the source; the source is loaded
+	 *              (and measured again) on the next draw.
+	 *  \param      source  Shared image source
+	 */
+	void setSource(std::shared_ptr<NTImageSource> source);
+
+	/*! \brief      Gets the image source
+	 *  \return     Shared image source (NTImageData if set from image data)
 	 */
-	const struct nt::Image& image() const;
+	std::shared_ptr<NTImageSource> source() const;
 
 	/*! \brief      Sets the image width
 	 *  \param      width   New width value
@@ -110,8 +154,22 @@ public:
 	 */
 	int draw() override;
 
+protected:
+	/*! \brief      Gets the area covered by the image
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Checks if the image overwrites every cell of its area
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if opaque, false otherwise
+	 */
+	bool opaque() const override;
+
 private:
-	struct nt::Image _image;			/*!< Image data storage */
+	std::shared_ptr<NTImageSource> _source;	/*!< Shared image payload */
+	bool _loaded;						/*!< Source is loaded (and measured if set by setSource()) */
 	unsigned int _width;				/*!< Image width */
 	unsigned int _height;				/*!< Image height */
 };
@@ -0,0 +1,140 @@
+/*!	\file		ntimagedata.cpp
+ *	\brief		Implementation of the NTImageData class
+ *	\details	Contains method implementations for shared image payloads in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntimagedata.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Standard integer types */
+#include <cstdint>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Standard hash map */
+#include <unordered_map>
+
+namespace {
+	// Hashes the image content (FNV-1a)
+	size_t hashImage(const nt::Image &image)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](const char *data, size_t size) {
+			for (size_t i = 0; i < size; i++) {
+				hash ^= static_cast<unsigned char>(data[i]);
+				hash *= 1099511628211ull;
+			}
+		};
+		for (const std::string &row : image.img) {
+			mix(row.data(), row.size());
+			mix("\n", 1);
+		}
+		mix(reinterpret_cast<const char *>(&image.width), sizeof(image.width));
+		mix(reinterpret_cast<const char *>(&image.height), sizeof(image.height));
+		return static_cast<size_t>(hash);
+	}
+
+	// Payloads in use, by content hash
+	struct InternTable {
+		std::mutex mutex;
+		std::unordered_multimap<size_t, std::weak_ptr<NTImageData>> entries;
+	};
+
+	// Gets the table (never destroyed: payloads held by static objects outlive it)
+	InternTable &internTable()
+	{
+		static InternTable *table = new InternTable;
+		return *table;
+	}
+
+	// Deletes a payload and its entry in the table
+	void release(size_t hash, NTImageData *data)
+	{
+		{
+			InternTable &table = internTable();
+			std::lock_guard<std::mutex> lock(table.mutex);
+			auto range = table.entries.equal_range(hash);
+			for (auto it = range.first; it != range.second; ) {
+				if (it->second.expired()) {
+					it = table.entries.erase(it);
+				} else {
+					++it;
+				}
+			}
+		}
+		delete data;
+	}
+}
+
+// Constructor
+NTImageData::NTImageData(const nt::Image &image)
+	: _image(image)
+{
+	_layouts.resize(_image.img.size());
+	for (size_t y = 0; y < _image.img.size(); y++) {
+		_layouts[y].assign(_image.img[y]);
+	}
+}
+
+// Gets the shared payload for the image
+std::shared_ptr<NTImageData> NTImageData::intern(const nt::Image &image)
+{
+	size_t hash = hashImage(image);
+	std::vector<std::shared_ptr<NTImageData>> others;	// released after the lock: the last owner erases its entry
+	InternTable &table = internTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	auto range = table.entries.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it) {
+		std::shared_ptr<NTImageData> data = it->second.lock();
+		if (!data) continue;	// its entry is erased by its deleter
+		const nt::Image &other = data->image();
+		if (other.width == image.width && other.height == image.height && other.img == image.img) {
+			return data;
+		}
+		others.push_back(std::move(data));
+	}
+
+	std::shared_ptr<NTImageData> data(new NTImageData(image), [hash](NTImageData *data) { release(hash, data); });
+	table.entries.emplace(hash, data);
+	return data;
+}
+
+// Gets the image data
+const nt::Image &NTImageData::image() const
+{
+	return _image;
+}
+
+// Payload is ready to use as is
+int NTImageData::load()
+{
+	return NT_OK;
+}
+
+// Gets the image width
+unsigned int NTImageData::width() const
+{
+	return _image.width;
+}
+
+// Gets the image height (never more than the number of rows)
+unsigned int NTImageData::height() const
+{
+	return std::min<unsigned int>(_image.height, _image.img.size());
+}
+
+// Gets the image row
+std::string_view NTImageData::row(unsigned int y) const
+{
+	return _image.img[y];
+}
+
+// Gets the column map of the row
+const nt::TextLayout &NTImageData::layout(unsigned int y) const
+{
+	return _layouts[y];
+}
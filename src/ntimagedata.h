@@ -0,0 +1,67 @@
+/*! \file       ntimagedata.h
+ *  \brief      NT Image data module (header file).
+ *  \details    Contains the NTImageData class definitions: immutable,
+ *              reference-counted image payload shared by NTImage widgets.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTIMAGEDATA_H_
+#define _NTIMAGEDATA_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+/*! \brief  Image source interface */
+#include "ntimagesource.h"
+
+/*! \class      NTImageData
+ *  \brief      Immutable image payload.
+ *  \details    Holds one copy of an nt::Image together with the column maps
+ *              of its rows. The payload never changes after construction, so
+ *              any number of widgets can share it and copying a widget only
+ *              copies a pointer. Changing the image of a widget replaces its
+ *              pointer (copy-on-write).
+ *  \extends    NTImageSource
+ */
+class NTImageData : public NTImageSource
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      image   Image data (copied once)
+	 */
+	explicit NTImageData(const nt::Image &image);
+
+	/*! \brief      Gets the shared payload for the image
+	 *  \details    Equal images get the same payload while any widget still
+	 *              uses it, so a grid of identical icons holds one copy.
+	 *              The last owner of a payload removes it from the table.
+	 *  \param      image   Image data
+	 *  \return     Shared payload
+	 */
+	static std::shared_ptr<NTImageData> intern(const nt::Image &image);
+
+	/*! \brief      Gets the image data
+	 *  \return     Constant reference to the image data
+	 */
+	const nt::Image &image() const;
+
+	int load() override;
+	unsigned int width() const override;
+	unsigned int height() const override;
+	std::string_view row(unsigned int y) const override;
+	const nt::TextLayout &layout(unsigned int y) const override;
+
+private:
+	const nt::Image _image;						/*!< Image data */
+	std::vector<nt::TextLayout> _layouts;		/*!< Column maps of the rows */
+};
+
+#endif // _NTIMAGEDATA_H_
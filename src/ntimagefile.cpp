@@ -0,0 +1,168 @@
+/*!	\file		ntimagefile.cpp
+ *	\brief		Implementation of the NTImageFile class
+ *	\details	Contains method implementations for memory-mapped text art files in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntimagefile.h"
+
+/*! \brief  Standard memory functions */
+#include <cstring>
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Mutex library (for std::call_once) */
+#include <mutex>
+
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+/*! \brief  Read-only mapped file */
+#include "ntmappedfile.h"
+
+/*!	\brief	Mapped file with its line views */
+struct NTImageFile::Mapping {
+	NTMappedFile file;						/*!< Mapped file */
+	std::vector<std::string_view> lines;	/*!< Views of every line in the mapping */
+};
+
+/*!	\brief	Frame of the file, measured on first load */
+class NTImageFile::Frame : public NTImageSource
+{
+public:
+	// The longest row in bytes bounds the width until the frame is measured
+	Frame(std::shared_ptr<Mapping> mapping, size_t first, size_t count)
+		: _mapping(std::move(mapping)), _first(first), _count(count), _width(0)
+	{
+		for (size_t y = 0; y < _count; y++) {
+			_width = std::max<unsigned int>(_width, _mapping->lines[_first + y].size());
+		}
+	}
+
+	// Measures the frame once
+	int load() override {
+		std::call_once(_once, [this] {
+			_layouts.resize(_count);
+			unsigned int width = 0;
+			for (size_t y = 0; y < _count; y++) {
+				_layouts[y].assign(_mapping->lines[_first + y]);
+				if (_layouts[y].columns > width) width = _layouts[y].columns;
+			}
+			_width = width;
+		});
+		return NT_OK;
+	}
+
+	unsigned int width() const override { return _width; }
+	unsigned int height() const override { return _count; }
+	std::string_view row(unsigned int y) const override { return _mapping->lines[_first + y]; }
+	const nt::TextLayout &layout(unsigned int y) const override { return _layouts[y]; }
+
+private:
+	std::shared_ptr<Mapping> _mapping;	/*!< Mapped file */
+	size_t _first;						/*!< First line of the frame */
+	size_t _count;						/*!< Number of lines in the frame */
+	unsigned int _width;				/*!< Frame width in columns (in bytes before load()) */
+	std::vector<nt::TextLayout> _layouts;	/*!< Column maps of the rows */
+	std::once_flag _once;				/*!< Guards the measurement */
+};
+
+// Default constructor
+NTImageFile::NTImageFile() = default;
+
+// Constructor that opens the file
+NTImageFile::NTImageFile(const std::string &path, const std::string &delimiter)
+{
+	open(path, delimiter);
+}
+
+// Destructor
+NTImageFile::~NTImageFile() = default;
+
+// Maps and scans the file
+int NTImageFile::open(const std::string &path, const std::string &delimiter)
+{
+	close();
+
+	auto mapping = std::make_shared<Mapping>();
+	if (mapping->file.open(path) != NT_OK) return NT_ERR;
+
+	// Single pass over the mapping: split lines and frames
+	const char *data = mapping->file.data();
+	const char *end = data + mapping->file.size();
+	size_t frame_first = 0;
+	std::vector<std::pair<size_t, size_t>> frames;
+
+	while (data < end) {
+		const char *eol = static_cast<const char *>(std::memchr(data, '\n', end - data));
+		const char *next = eol ? eol + 1 : end;
+		if (!eol) eol = end;
+		if (eol > data && eol[-1] == '\r') eol--;
+
+		std::string_view line(data, eol - data);
+		if (!delimiter.empty() && line == delimiter) {
+			if (mapping->lines.size() > frame_first) {
+				frames.emplace_back(frame_first, mapping->lines.size() - frame_first);
+			}
+			frame_first = mapping->lines.size();
+		} else {
+			mapping->lines.push_back(line);
+		}
+		data = next;
+	}
+
+	// Last frame (empty frames are skipped)
+	if (mapping->lines.size() > frame_first) {
+		frames.emplace_back(frame_first, mapping->lines.size() - frame_first);
+	}
+
+	_frames.reserve(frames.size());
+	for (const auto &frame : frames) {
+		_frames.push_back(std::make_shared<Frame>(mapping, frame.first, frame.second));
+	}
+	_mapping = mapping;
+	return NT_OK;
+}
+
+// Releases the frames list
+void NTImageFile::close()
+{
+	_frames.clear();
+	_mapping.reset();
+}
+
+// Checks if the file is open
+bool NTImageFile::isOpen() const
+{
+	return _mapping != nullptr;
+}
+
+// Gets the number of frames
+size_t NTImageFile::frameCount() const
+{
+	return _frames.size();
+}
+
+// Gets the frame source
+std::shared_ptr<NTImageSource> NTImageFile::frame(size_t index) const
+{
+	if (index >= _frames.size()) return nullptr;
+	return _frames[index];
+}
+
+// Copies the frame into an nt::Image
+nt::Image NTImageFile::image(size_t index) const
+{
+	nt::Image image = {{}, 0, 0};
+	if (index >= _frames.size()) return image;
+
+	Frame &frame = *_frames[index];
+	frame.load();
+	image.img.reserve(frame.height());
+	for (unsigned int y = 0; y < frame.height(); y++) {
+		image.img.emplace_back(frame.row(y));
+	}
+	image.width = frame.width();
+	image.height = frame.height();
+	return image;
+}
@@ -0,0 +1,93 @@
+/*! \file       ntimagefile.h
+ *  \brief      NT Image file module (header file).
+ *  \details    Contains the NTImageFile class definitions for loading
+ *              text art images from disk in the NT system.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTIMAGEFILE_H_
+#define _NTIMAGEFILE_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard string view */
+#include <string_view>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Image source interface */
+#include "ntimagesource.h"
+
+/*! \class      NTImageFile
+ *  \brief      Memory-mapped text art file.
+ *  \details    The file is mapped read-only and scanned once on open(): every
+ *              line becomes a view into the mapping, and lines equal to the
+ *              delimiter split the file into frames. Frames are returned as
+ *              NTImageSource objects that measure themselves on first load()
+ *              and keep the mapping alive after the file object is gone.
+ */
+class NTImageFile
+{
+public:
+	/*! \brief  Default constructor */
+	NTImageFile();
+
+	/*! \brief      Constructor that opens the file
+	 *  \param      path        Path to the text art file
+	 *  \param      delimiter   Line that separates frames (empty for a single frame)
+	 */
+	NTImageFile(const std::string &path, const std::string &delimiter = "---");
+
+	/*! \brief  Destructor */
+	~NTImageFile();
+
+	NTImageFile(const NTImageFile&) = delete;
+	NTImageFile& operator=(const NTImageFile&) = delete;
+
+	/*! \brief      Maps and scans the file
+	 *  \param      path        Path to the text art file
+	 *  \param      delimiter   Line that separates frames (empty for a single frame)
+	 *  \return     NT_OK if success, NT_ERR if the file can not be mapped
+	 */
+	int open(const std::string &path, const std::string &delimiter = "---");
+
+	/*! \brief  Releases the frames list (frames in use keep the mapping) */
+	void close();
+
+	/*! \brief      Checks if the file is open
+	 *  \return     true if open, false otherwise
+	 */
+	bool isOpen() const;
+
+	/*! \brief      Gets the number of frames
+	 *  \return     Number of frames in the file
+	 */
+	size_t frameCount() const;
+
+	/*! \brief      Gets the frame source
+	 *  \param      index   Frame index
+	 *  \return     Shared frame source or nullptr if the index is out of range
+	 */
+	std::shared_ptr<NTImageSource> frame(size_t index) const;
+
+	/*! \brief      Copies the frame into an nt::Image
+	 *  \param      index   Frame index
+	 *  \return     Image data (empty if the index is out of range)
+	 */
+	nt::Image image(size_t index) const;
+
+private:
+	struct Mapping;
+	class Frame;
+
+	std::shared_ptr<Mapping> _mapping;				/*!< Mapped file with its line views */
+	std::vector<std::shared_ptr<Frame>> _frames;	/*!< Frame sources */
+};
+
+#endif // _NTIMAGEFILE_H_
@@ -0,0 +1,74 @@
+/*! \file       ntimagesource.h
+ *  \brief      NT Image source interface (header file).
+ *  \details    Contains the NTImageSource interface used by NTImage to read
+ *              image rows that are not stored in an nt::Image.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTIMAGESOURCE_H_
+#define _NTIMAGESOURCE_H_
+
+/*! \brief  Standard string view */
+#include <string_view>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+/*! \class      NTImageSource
+ *  \brief      Read-only provider of image rows.
+ *  \details    Rows are views into memory owned by the source, so no row is
+ *              copied on the way to the terminal. The source may defer its
+ *              work until load() is called, which NTImage does on first draw.
+ *              Column maps of the rows are cached by the source, so widgets
+ *              sharing a source share them too.
+ *              Implementations must make load() safe to call from several threads.
+ */
+class NTImageSource
+{
+public:
+	/*! \brief  Virtual destructor to allow proper inheritance */
+	virtual ~NTImageSource() = default;
+
+	/*! \brief      Prepares the rows for reading
+	 *  \return     NT_OK if success, NT_ERR otherwise
+	 */
+	virtual int load() = 0;
+
+	/*! \brief      Gets the image width
+	 *  \details    Known before load(), so a widget has its bounds before
+	 *              its first draw; a source that measures its rows on load()
+	 *              may give a larger width until then.
+	 *  \return     Width in columns
+	 */
+	virtual unsigned int width() const = 0;
+
+	/*! \brief      Gets the image height
+	 *  \return     Number of rows (known before load())
+	 */
+	virtual unsigned int height() const = 0;
+
+	/*! \brief      Gets the image row
+	 *  \param      y   Row index (must be less than height())
+	 *  \return     UTF-8 bytes of the row
+	 */
+	virtual std::string_view row(unsigned int y) const = 0;
+
+	/*! \brief      Gets the column map of the row
+	 *  \param      y   Row index (must be less than height())
+	 *  \return     Column map (valid after load())
+	 */
+	virtual const nt::TextLayout &layout(unsigned int y) const = 0;
+
+	/*! \brief      Gets the style plane row
+	 *  \param      y   Row index (must be less than height())
+	 *  \return     width() color pairs of the row (0 - widget color pair),
+	 *              or nullptr if the source has no style plane
+	 */
+	virtual const unsigned char *style(unsigned int y) const { (void)y; return nullptr; }
+};
+
+#endif // _NTIMAGESOURCE_H_
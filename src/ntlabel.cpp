@@ -18,17 +18,20 @@ NTLabel::NTLabel(NTObject* parent, const std::string& name)
 	_text("")						// Empty text
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	_layout.assign(_text);
 	//notifyObservers();
 }
 
 // Parameterized constructor
 NTLabel::NTLabel(NTObject* parent, const std::string& name,
 				const std::string& text, int x, int y,
-				unsigned char colorPair, chtype attr, unsigned char ntattr)
-	: NTGraphicObject(parent, name, x, y, colorPair, attr, ntattr),
-	_text(text)
+				unsigned char colorPair, chtype attr, unsigned char ntattr,
+				std::pmr::memory_resource *resource)
+	: NTGraphicObject(parent, name, x, y, colorPair, attr, ntattr, resource),
+	_text(text, resource)
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	_layout.assign(_text);
 	//notifyObservers();
 }
 
@@ -39,9 +42,11 @@ NTLabel::NTLabel(const NTLabel& other)
 	other._colorPair,								// Color pair to draw from the palette
 	other._attr,									// attr
 	other._ntattr),									// ntattr
-	_text(other._text)								// image
+	_text(other._text)								// text (on the heap)
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	std::lock_guard<std::mutex> other_lock(other._mutex);
+	_layout = other._layout;
 	//notifyObservers();
 }
 
@@ -58,12 +63,14 @@ NTLabel& NTLabel::operator=(const NTLabel& other)
 
 		NTObject::operator=(other);
 		_text = other._text;
+		_layout = other._layout;
 		_x = other._x;
 		_y = other._y;
 		_colorPair = other._colorPair;
 		_attr = other._attr;
 		_ntattr = other._ntattr;
 		_changed = true;
+		placed();
 	}
 	//notifyObservers();
 	return *this;
@@ -73,8 +80,11 @@ NTLabel& NTLabel::operator=(const NTLabel& other)
 void NTLabel::setText(const std::string& text)
 {
 	std::lock_guard<std::mutex> lock(_mutex);
+	if (std::string_view(text) == std::string_view(_text)) return;	// same text: nothing to redraw
 	_text = text;
+	_layout.assign(_text);
 	_changed = true;
+	placed();
 	//notifyObservers();
 }
 
@@ -82,7 +92,19 @@ void NTLabel::setText(const std::string& text)
 std::string NTLabel::text() const
 {
 	std::lock_guard<std::mutex> lock(_mutex);
-	return _text;
+	return std::string(_text);
+}
+
+// Gets the area covered by the label
+nt::Rect NTLabel::area() const
+{
+	return {_x, _y, static_cast<int>(_layout.columns), 1};
+}
+
+// Spaces of the label overwrite the cells unless transparent
+bool NTLabel::opaque() const
+{
+	return !(_ntattr & NTA_SPACE_TRANSPARENT);
 }
 
 // Draw the text label
@@ -92,7 +114,7 @@ int NTLabel::draw() {
 
 	// Get terminal dimensions
 	int max_y, max_x;
-	getmaxyx(stdscr, max_y, max_x);
+	getmaxyx(window(), max_y, max_x);
 
 	// Check if Y-position is out of bounds or no need to draw
 	if ( _y < 0 || _y >= max_y ) {
@@ -100,81 +122,15 @@ int NTLabel::draw() {
 	}
 
 	// Check if X-position is out of bounds or no need to draw
-	if ( _x+_text.length() < 0 || _x >= max_x) {
+	if ( _x + static_cast<int>(_layout.columns) <= 0 || _x >= max_x) {
 		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
 	}
 
 	// Position (Y, X) completely out of bounds
 	if(NT_OK != result) return result;
 
-	// Get the start character and length
-	int visible_hstart = 0;
-	int visible_hlength = 0;
-
-	if(_x < 0) {
-		visible_hstart = 0 - _x;
-	}
-
-	visible_hlength = _text.length();
-
-	if(visible_hlength + _x > max_x) {
-		visible_hlength = max_x - _x;
-	}
-
-	// If no visible characters left
-	if (visible_hlength <= 0) {
-		result |=  NT_ERR_INVISIBLE_X;
-	}
-
-	// If text is invisible
-	if(NT_OK != result) return result;
-
-	// Draw visible portion
-	for(int x = visible_hstart; x < visible_hlength; x++){
-		// Move cursor to the x, y - position to get the attrs
-		result = move(_y, _x + x);
-
-		// Get the attrs in the current cursor position
-		chtype ch = inch();					// Get character and attrs
-		int color_pair = PAIR_NUMBER(ch);	// Get color pair
-		int attributes = ch & A_ATTRIBUTES;	// Get attr
-
-		// If attrs for the text then...
-		if( _ntattr & NTA_TEXT_ATTR ){
-			if(_text.at(x) != ' '){
-				color_pair = _colorPair;
-				attributes = _attr;
-			}
-		}
-
-		// If attr for the space then...
-		if( _ntattr & NTA_SPACE_ATTR ){
-			if(_text.at(x) == ' '){
-				color_pair = _colorPair;
-				attributes = _attr;
-			}
-		}
-
-		// Prepare character to print in terminal
-		if( _ntattr & NTA_SPACE_TRANSPARENT ){
-			if(_text.at(x) == ' '){
-				ch = inch();
-			}else{
-				ch = _text.at(x);
-			}
-		}else{
-			ch = _text.at(x);
-		}
-
-		// Set the attrs, color, background color
-		result = attron(COLOR_PAIR(color_pair) | attributes);
-
-		// Print character
-		result = addch(ch);
-
-		// Unset attrs
-		result = attroff(COLOR_PAIR(color_pair) | attributes);
-	}
+	// Draw visible portion (columns, not bytes)
+	result = drawText(_y, _x, _text, _layout, max_x);
 
 	// If any fatal error occured then return ERR
 	if (result == ERR) {
@@ -182,7 +138,7 @@ int NTLabel::draw() {
 	}
 
 	// No fatal error occured
-	refresh();
+	present();
 	_changed = false;
 	return result;
 }
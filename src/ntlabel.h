@@ -54,10 +54,12 @@ public:
 	 *	\param		colorPair	Color pair to draw from the palette
 	 *	\param		attr		Attr of the text label
 	 *	\param      ntattr		nt attr for the text label
+	 *	\param		resource	Memory resource for the name and text (default: heap)
 	 */
 	NTLabel(NTObject *parent, const std::string& name,
 			const std::string& text,
-			int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr);
+			int x, int y, unsigned char colorPair, chtype attr, unsigned char ntattr,
+			std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	/*! \brief  Destructor */
 	~NTLabel();
@@ -90,8 +92,22 @@ public:
 	 */
 	int draw() override;
 
+protected:
+	/*! \brief      Gets the area covered by the label
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Checks if the label overwrites every cell of its area
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if opaque, false otherwise
+	 */
+	bool opaque() const override;
+
 private:
-	std::string _text;			/*!< Text data */
+	std::pmr::string _text;		/*!< Text data */
+	nt::TextLayout _layout;		/*!< Cached column map of the text */
 };
 
 #endif // _NTLABEL_H_
@@ -0,0 +1,435 @@
+/*!	\file		ntlayout.cpp
+ *	\brief		Implementation of thread-safe NTLayout class
+ *	\details	Contains method implementations for widget layouts in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntlayout.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+namespace {
+	// Keeps a size within the constraints
+	int clamp(int size, int min, int max)
+	{
+		return std::max(std::min(size, max), min);
+	}
+
+	// Adds sizes without overflow (max sizes may be INT_MAX)
+	int sum(int a, int b)
+	{
+		long sum = static_cast<long>(a) + b;
+		return static_cast<int>(std::min<long>(sum, INT_MAX));
+	}
+}
+
+// Constructor
+NTLayout::NTLayout(Kind kind)
+	: _kind(kind), _spacing(0), _margin(0), _columns(1), _dirty(true), _placed(false),
+	_natural({0, 0}), _rect({0, 0, 0, 0}), _computed(0) {}
+
+// Destructor
+NTLayout::~NTLayout() = default;
+
+// Adds a widget after the other items
+void NTLayout::add(NTGraphicObject *object, const Constraints &constraints)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!object || find(object, nullptr)) return;
+	_items.push_back({object, nullptr, constraints, {0, 0}, {0, 0}, false, {0, 0, 0, 0}, false});
+	_dirty = true;
+}
+
+// Adds a nested layout after the other items
+void NTLayout::add(NTLayout *layout, const Constraints &constraints)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!layout || layout == this || find(nullptr, layout)) return;
+	_items.push_back({nullptr, layout, constraints, {0, 0}, {0, 0}, false, {0, 0, 0, 0}, false});
+	_dirty = true;
+}
+
+// Removes a widget
+void NTLayout::remove(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = std::find_if(_items.begin(), _items.end(), [object](const Item &item) { return item.object == object; });
+	if (it == _items.end()) return;
+	_items.erase(it);
+	_dirty = true;
+}
+
+// Removes a nested layout
+void NTLayout::remove(NTLayout *layout)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = std::find_if(_items.begin(), _items.end(), [layout](const Item &item) { return item.layout == layout; });
+	if (it == _items.end()) return;
+	_items.erase(it);
+	_dirty = true;
+}
+
+// Sets the constraints of a widget
+void NTLayout::setConstraints(NTGraphicObject *object, const Constraints &constraints)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	Item *item = find(object, nullptr);
+	if (!item) return;
+	item->constraints = constraints;
+	_dirty = true;
+}
+
+// Sets the constraints of a nested layout
+void NTLayout::setConstraints(NTLayout *layout, const Constraints &constraints)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	Item *item = find(nullptr, layout);
+	if (!item) return;
+	item->constraints = constraints;
+	_dirty = true;
+}
+
+// Sets the placement of the items
+void NTLayout::setKind(Kind kind)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (kind == _kind) return;
+	_kind = kind;
+	_dirty = true;
+}
+
+// Gets the placement of the items
+NTLayout::Kind NTLayout::kind() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _kind;
+}
+
+// Sets the space between the items
+void NTLayout::setSpacing(int spacing)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	spacing = std::max(spacing, 0);
+	if (spacing == _spacing) return;
+	_spacing = spacing;
+	_dirty = true;
+}
+
+// Gets the space between the items
+int NTLayout::spacing() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _spacing;
+}
+
+// Sets the space around the items
+void NTLayout::setMargin(int margin)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	margin = std::max(margin, 0);
+	if (margin == _margin) return;
+	_margin = margin;
+	_dirty = true;
+}
+
+// Gets the space around the items
+int NTLayout::margin() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _margin;
+}
+
+// Sets the number of columns of a Grid layout
+void NTLayout::setColumns(unsigned int columns)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	columns = std::max(columns, 1u);
+	if (columns == _columns) return;
+	_columns = columns;
+	_dirty = true;
+}
+
+// Gets the number of columns of a Grid layout
+unsigned int NTLayout::columns() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _columns;
+}
+
+// Gets the size the items need
+nt::Size NTLayout::measure()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return update();
+}
+
+// Lays the items out in an area
+void NTLayout::apply(const nt::Rect &rect)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	size_t computed = 0;
+	update();
+	place(rect, computed);
+	_computed = computed;
+}
+
+// Gets the area of the last apply()
+nt::Rect NTLayout::geometry() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _rect;
+}
+
+// Computes the areas again on the next apply()
+void NTLayout::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_dirty = true;
+}
+
+// Gets the number of layouts computed by the last apply()
+size_t NTLayout::computed() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _computed;
+}
+
+// Measures the items and the layout
+nt::Size NTLayout::update()
+{
+	// Content sizes of the items: a size the widget took from the layout is not its content
+	for (Item &item : _items) {
+		nt::Size natural = item.natural;
+		if (item.layout) {
+			natural = item.layout->measure();
+		} else {
+			nt::Size measured = item.object->measure();
+			if (!item.sized || measured != item.assigned) natural = measured;
+		}
+		if (natural != item.natural) {
+			item.natural = natural;
+			_dirty = true;
+		}
+	}
+	if (!_dirty) return _natural;
+
+	// Content size of the layout
+	int width = 0, height = 0;
+	size_t count = _items.size();
+	size_t columns = _kind == Horizontal ? count : _kind == Vertical ? 1 : std::min<size_t>(_columns, count);
+	if (_kind == Anchor) {
+		for (const Item &item : _items) {
+			const Constraints &c = item.constraints;
+			int w = clamp(item.natural.width, c.minWidth, c.maxWidth);
+			int h = clamp(item.natural.height, c.minHeight, c.maxHeight);
+			width = std::max(width, w + (c.anchors & NTL_LEFT ? c.left : 0) + (c.anchors & NTL_RIGHT ? c.right : 0));
+			height = std::max(height, h + (c.anchors & NTL_TOP ? c.top : 0) + (c.anchors & NTL_BOTTOM ? c.bottom : 0));
+		}
+	} else if (count > 0) {
+		size_t rows = (count + columns - 1) / columns;
+		std::vector<int> widths(columns, 0), heights(rows, 0);
+		for (size_t i = 0; i < count; i++) {
+			const Constraints &c = _items[i].constraints;
+			widths[i % columns] = std::max(widths[i % columns], clamp(_items[i].natural.width, c.minWidth, c.maxWidth));
+			heights[i / columns] = std::max(heights[i / columns], clamp(_items[i].natural.height, c.minHeight, c.maxHeight));
+		}
+		for (int w : widths) width += w;
+		for (int h : heights) height += h;
+		width += _spacing * static_cast<int>(columns - 1);
+		height += _spacing * static_cast<int>(rows - 1);
+	}
+	_natural = {width + 2 * _margin, height + 2 * _margin};
+	return _natural;
+}
+
+// Assigns the areas of the items
+void NTLayout::place(const nt::Rect &rect, size_t &computed)
+{
+	// Nothing changed: only the nested layouts may have work to do
+	if (!_dirty && _placed && rect == _rect) {
+		for (Item &item : _items) {
+			if (item.layout) item.layout->arrange(item.rect, computed);
+		}
+		return;
+	}
+
+	nt::Rect inner = {rect.x + _margin, rect.y + _margin,
+					  std::max(rect.width - 2 * _margin, 0), std::max(rect.height - 2 * _margin, 0)};
+	std::vector<nt::Rect> rects(_items.size(), nt::Rect{0, 0, 0, 0});
+	if (_kind == Anchor) {
+		anchor(inner, rects);
+	} else if (_kind == Grid) {
+		grid(inner, rects);
+	} else {
+		box(inner, rects);
+	}
+
+	// Only the items whose area changed are moved
+	for (size_t i = 0; i < _items.size(); i++) {
+		Item &item = _items[i];
+		if (item.layout) {
+			item.layout->arrange(rects[i], computed);
+		} else if (!item.placed || rects[i] != item.rect) {
+			item.sized = item.object->setGeometry(rects[i]);
+			item.assigned = {std::max(rects[i].width, 0), std::max(rects[i].height, 0)};
+		}
+		item.rect = rects[i];
+		item.placed = true;
+	}
+
+	_rect = rect;
+	_dirty = false;
+	_placed = true;
+	computed++;
+}
+
+// Locks the layout and assigns the areas of the items
+void NTLayout::arrange(const nt::Rect &rect, size_t &computed)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	place(rect, computed);
+}
+
+// Computes the areas of a Horizontal or Vertical layout
+void NTLayout::box(const nt::Rect &inner, std::vector<nt::Rect> &rects)
+{
+	if (_items.empty()) return;
+	bool horizontal = _kind == Horizontal;
+
+	// Sizes along the box
+	_columnSpans.clear();
+	for (const Item &item : _items) {
+		const Constraints &c = item.constraints;
+		if (horizontal) {
+			_columnSpans.push_back({clamp(item.natural.width, c.minWidth, c.maxWidth), c.minWidth, c.maxWidth, c.flex});
+		} else {
+			_columnSpans.push_back({clamp(item.natural.height, c.minHeight, c.maxHeight), c.minHeight, c.maxHeight, c.flex});
+		}
+	}
+	int gaps = _spacing * static_cast<int>(_items.size() - 1);
+	distribute(_columnSpans, (horizontal ? inner.width : inner.height) - gaps);
+
+	// Items follow each other and fill the other direction
+	int offset = horizontal ? inner.x : inner.y;
+	for (size_t i = 0; i < _items.size(); i++) {
+		const Constraints &c = _items[i].constraints;
+		int size = _columnSpans[i].size;
+		if (horizontal) {
+			rects[i] = {offset, inner.y, size, clamp(inner.height, c.minHeight, c.maxHeight)};
+		} else {
+			rects[i] = {inner.x, offset, clamp(inner.width, c.minWidth, c.maxWidth), size};
+		}
+		offset += size + _spacing;
+	}
+}
+
+// Computes the areas of a Grid layout
+void NTLayout::grid(const nt::Rect &inner, std::vector<nt::Rect> &rects)
+{
+	if (_items.empty()) return;
+	size_t columns = std::min<size_t>(_columns, _items.size());
+	size_t rows = (_items.size() + columns - 1) / columns;
+
+	// A column (row) is as wide as its widest item and as flexible as its most flexible one
+	_columnSpans.assign(columns, Span{0, 0, INT_MAX, 0});
+	_rowSpans.assign(rows, Span{0, 0, INT_MAX, 0});
+	for (size_t i = 0; i < _items.size(); i++) {
+		const Item &item = _items[i];
+		const Constraints &c = item.constraints;
+		Span &column = _columnSpans[i % columns];
+		column.size = std::max(column.size, clamp(item.natural.width, c.minWidth, c.maxWidth));
+		column.min = std::max(column.min, c.minWidth);
+		column.flex = std::max(column.flex, c.flex);
+		Span &row = _rowSpans[i / columns];
+		row.size = std::max(row.size, clamp(item.natural.height, c.minHeight, c.maxHeight));
+		row.min = std::max(row.min, c.minHeight);
+		row.flex = std::max(row.flex, c.flex);
+	}
+	distribute(_columnSpans, inner.width - _spacing * static_cast<int>(columns - 1));
+	distribute(_rowSpans, inner.height - _spacing * static_cast<int>(rows - 1));
+
+	// Items fill their cells within their own constraints
+	int y = inner.y;
+	for (size_t r = 0; r < rows; r++) {
+		int x = inner.x;
+		for (size_t col = 0; col < columns && r * columns + col < _items.size(); col++) {
+			size_t i = r * columns + col;
+			const Constraints &c = _items[i].constraints;
+			rects[i] = {x, y, clamp(_columnSpans[col].size, c.minWidth, c.maxWidth),
+						clamp(_rowSpans[r].size, c.minHeight, c.maxHeight)};
+			x += _columnSpans[col].size + _spacing;
+		}
+		y += _rowSpans[r].size + _spacing;
+	}
+}
+
+// Computes the areas of an Anchor layout
+void NTLayout::anchor(const nt::Rect &inner, std::vector<nt::Rect> &rects) const
+{
+	for (size_t i = 0; i < _items.size(); i++) {
+		const Item &item = _items[i];
+		const Constraints &c = item.constraints;
+
+		// Anchored to both edges: stretch, to one: keep the margin, to none: center
+		int width = clamp(item.natural.width, c.minWidth, c.maxWidth);
+		if ((c.anchors & NTL_LEFT) && (c.anchors & NTL_RIGHT)) {
+			width = clamp(inner.width - c.left - c.right, c.minWidth, c.maxWidth);
+		}
+		int x = c.anchors & NTL_LEFT ? inner.x + c.left
+			  : c.anchors & NTL_RIGHT ? inner.x + inner.width - c.right - width
+			  : inner.x + (inner.width - width) / 2;
+
+		int height = clamp(item.natural.height, c.minHeight, c.maxHeight);
+		if ((c.anchors & NTL_TOP) && (c.anchors & NTL_BOTTOM)) {
+			height = clamp(inner.height - c.top - c.bottom, c.minHeight, c.maxHeight);
+		}
+		int y = c.anchors & NTL_TOP ? inner.y + c.top
+			  : c.anchors & NTL_BOTTOM ? inner.y + inner.height - c.bottom - height
+			  : inner.y + (inner.height - height) / 2;
+
+		rects[i] = {x, y, width, height};
+	}
+}
+
+// Shares the free space between the spans
+void NTLayout::distribute(std::vector<Span> &spans, int available)
+{
+	int used = 0;
+	for (const Span &span : spans) used = sum(used, span.size);
+	long free = static_cast<long>(available) - used;
+
+	// Flex spans take (give back) shares of the free space until they hit max (min)
+	while (free != 0) {
+		unsigned long total = 0;
+		for (const Span &span : spans) {
+			if (span.flex && (free > 0 ? span.size < span.max : span.size > span.min)) total += span.flex;
+		}
+		if (total == 0) break;
+
+		long given = 0;
+		for (Span &span : spans) {
+			if (!span.flex || (free > 0 ? span.size >= span.max : span.size <= span.min)) continue;
+			long share = free * static_cast<long>(span.flex) / static_cast<long>(total);
+			if (share == 0) share = free > 0 ? 1 : -1;	// remainder goes to the first spans
+			if (std::labs(given + share) > std::labs(free)) share = free - given;
+			int size = clamp(static_cast<int>(span.size + share), span.min, span.max);
+			given += size - span.size;
+			span.size = size;
+			if (given == free) break;
+		}
+		if (given == 0) break;
+		free -= given;
+	}
+}
+
+// Finds an item
+NTLayout::Item *NTLayout::find(const NTGraphicObject *object, const NTLayout *layout)
+{
+	for (Item &item : _items) {
+		if (object ? item.object == object : item.layout == layout) return &item;
+	}
+	return nullptr;
+}
@@ -0,0 +1,289 @@
+/*! \file       ntlayout.h
+ *  \brief      NT Layout module (header file).
+ *  \details    Contains the NTLayout class definitions: box, grid and anchor
+ *              layouts that compute the areas of widgets in one pass.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTLAYOUT_H_
+#define _NTLAYOUT_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Numeric limits */
+#include <climits>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+
+#define NTL_NONE	0			/*!< Not anchored (centered) */
+#define NTL_LEFT	(1 << 0)	/*!< Anchored to the left edge */
+#define NTL_TOP		(1 << 1)	/*!< Anchored to the top edge */
+#define NTL_RIGHT	(1 << 2)	/*!< Anchored to the right edge */
+#define NTL_BOTTOM	(1 << 3)	/*!< Anchored to the bottom edge */
+
+namespace nt {
+	/*!
+	 *  \struct Constraints
+	 *  \brief    Structure representing constraints of a layout item
+	 */
+	struct Constraints {
+		int minWidth = 0;				/*!< Minimal width */
+		int minHeight = 0;				/*!< Minimal height */
+		int maxWidth = INT_MAX;			/*!< Maximal width */
+		int maxHeight = INT_MAX;		/*!< Maximal height */
+		unsigned int flex = 0;			/*!< Share of the free space (0 - content size) */
+		unsigned char anchors = NTL_LEFT | NTL_TOP;	/*!< NTL_* edges of an Anchor layout */
+		int left = 0;					/*!< Margin to the left edge */
+		int top = 0;					/*!< Margin to the top edge */
+		int right = 0;					/*!< Margin to the right edge */
+		int bottom = 0;					/*!< Margin to the bottom edge */
+	};
+} // namespace nt
+
+/*! \class      NTLayout
+ *  \brief      Layout of widgets and nested layouts.
+ *  \details    apply() assigns an area to every item in one pass:
+ *              - Horizontal, Vertical: a row or a column of items. Items get
+ *                their content size (see NTGraphicObject::measure()) within
+ *                min/max; the free space is shared by the items with flex
+ *                in proportion to it (flex items also shrink when the space
+ *                is short). Items fill the other direction within min/max.
+ *              - Grid: items in rows of columns(); a column is as wide as
+ *                its widest item, a row as high as its highest item, and
+ *                flex columns and rows share the free space.
+ *              - Anchor: every item is placed by its anchors and margins;
+ *                anchored to both edges it stretches, to none it is centered.
+ *
+ *              Results are cached. A pass measures the widgets, but only
+ *              the layouts whose items, constraints, content sizes or area
+ *              changed compute the areas again, and only the widgets whose
+ *              area changed are moved (NTGraphicObject::setGeometry()).
+ *              Widgets with a settable size take the size of the area; the
+ *              others are only moved to its corner.
+ *
+ *              The layout does not own the items. An item must be removed
+ *              before it is destroyed, and a layout may be nested in one
+ *              layout only. NTScreen::setLayout() applies a layout to the
+ *              whole screen before every frame, so a resize lays it out again.
+ */
+class NTLayout
+{
+public:
+	/*!	\brief	Placement of the items */
+	enum Kind {
+		Horizontal,		/*!< Row of items */
+		Vertical,		/*!< Column of items */
+		Grid,			/*!< Rows of columns() items */
+		Anchor			/*!< Items anchored to the edges */
+	};
+
+	/*!	\brief	Constraints of an item */
+	using Constraints = nt::Constraints;
+
+	/*! \brief      Constructor
+	 *  \param      kind    Placement of the items
+	 */
+	explicit NTLayout(Kind kind = Vertical);
+
+	/*! \brief  Destructor */
+	~NTLayout();
+
+	NTLayout(const NTLayout&) = delete;
+	NTLayout& operator=(const NTLayout&) = delete;
+
+	/*! \brief      Adds a widget after the other items
+	 *  \param      object      Widget
+	 *  \param      constraints Constraints of the widget
+	 */
+	void add(NTGraphicObject *object, const Constraints &constraints = Constraints());
+
+	/*! \brief      Adds a nested layout after the other items
+	 *  \param      layout      Layout
+	 *  \param      constraints Constraints of the layout
+	 */
+	void add(NTLayout *layout, const Constraints &constraints = Constraints());
+
+	/*! \brief      Removes a widget
+	 *  \param      object  Widget
+	 */
+	void remove(NTGraphicObject *object);
+
+	/*! \brief      Removes a nested layout
+	 *  \param      layout  Layout
+	 */
+	void remove(NTLayout *layout);
+
+	/*! \brief      Sets the constraints of a widget
+	 *  \param      object      Widget
+	 *  \param      constraints New constraints
+	 */
+	void setConstraints(NTGraphicObject *object, const Constraints &constraints);
+
+	/*! \brief      Sets the constraints of a nested layout
+	 *  \param      layout      Layout
+	 *  \param      constraints New constraints
+	 */
+	void setConstraints(NTLayout *layout, const Constraints &constraints);
+
+	/*! \brief      Sets the placement of the items
+	 *  \param      kind    Placement
+	 */
+	void setKind(Kind kind);
+
+	/*! \brief      Gets the placement of the items
+	 *  \return     Placement
+	 */
+	Kind kind() const;
+
+	/*! \brief      Sets the space between the items
+	 *  \param      spacing Cells between neighbour items
+	 */
+	void setSpacing(int spacing);
+
+	/*! \brief      Gets the space between the items
+	 *  \return     Cells between neighbour items
+	 */
+	int spacing() const;
+
+	/*! \brief      Sets the space around the items
+	 *  \param      margin  Cells from the edges of the area
+	 */
+	void setMargin(int margin);
+
+	/*! \brief      Gets the space around the items
+	 *  \return     Cells from the edges of the area
+	 */
+	int margin() const;
+
+	/*! \brief      Sets the number of columns of a Grid layout
+	 *  \param      columns Items in a row (at least 1)
+	 */
+	void setColumns(unsigned int columns);
+
+	/*! \brief      Gets the number of columns of a Grid layout
+	 *  \return     Items in a row
+	 */
+	unsigned int columns() const;
+
+	/*! \brief      Gets the size the items need
+	 *  \return     Content size of the items with the spacing and the margin
+	 */
+	nt::Size measure();
+
+	/*! \brief      Lays the items out in an area
+	 *  \param      rect    Area of the layout
+	 */
+	void apply(const nt::Rect &rect);
+
+	/*! \brief      Gets the area of the last apply()
+	 *  \return     Area of the layout
+	 */
+	nt::Rect geometry() const;
+
+	/*! \brief      Computes the areas again on the next apply() */
+	void invalidate();
+
+	/*! \brief      Gets the number of layouts computed by the last apply()
+	 *  \return     Number of layouts (this one and the nested ones)
+	 */
+	size_t computed() const;
+
+private:
+	/*!	\brief	Widget or nested layout */
+	struct Item {
+		NTGraphicObject *object;	/*!< Widget (nullptr - layout) */
+		NTLayout *layout;			/*!< Nested layout (nullptr - widget) */
+		Constraints constraints;	/*!< Constraints of the item */
+		nt::Size natural;			/*!< Content size of the last pass */
+		nt::Size assigned;			/*!< Size the widget took from the layout */
+		bool sized;					/*!< Widget took the size of its area */
+		nt::Rect rect;				/*!< Area of the item */
+		bool placed;				/*!< Area was assigned at least once */
+	};
+
+	/*!	\brief	Item sizes along one direction */
+	struct Span {
+		int size;					/*!< Size (content size at first) */
+		int min;					/*!< Minimal size */
+		int max;					/*!< Maximal size */
+		unsigned int flex;			/*!< Share of the free space */
+	};
+
+	/*! \brief      Measures the items and the layout
+	 *  \details    Must be called with _mutex held. Marks the layout dirty
+	 *              when the content size of an item changed.
+	 *  \return     Content size of the layout
+	 */
+	nt::Size update();
+
+	/*! \brief      Assigns the areas of the items
+	 *  \details    Must be called with _mutex held.
+	 *  \param      rect        Area of the layout
+	 *  \param      computed    Counter of computed layouts
+	 */
+	void place(const nt::Rect &rect, size_t &computed);
+
+	/*! \brief      Locks the layout and assigns the areas of the items
+	 *  \param      rect        Area of the layout
+	 *  \param      computed    Counter of computed layouts
+	 */
+	void arrange(const nt::Rect &rect, size_t &computed);
+
+	/*! \brief      Computes the areas of a Horizontal or Vertical layout
+	 *  \details    Must be called with _mutex held.
+	 *  \param      inner   Area inside the margin
+	 *  \param      rects   Areas of the items
+	 */
+	void box(const nt::Rect &inner, std::vector<nt::Rect> &rects);
+
+	/*! \brief      Computes the areas of a Grid layout
+	 *  \details    Must be called with _mutex held.
+	 *  \param      inner   Area inside the margin
+	 *  \param      rects   Areas of the items
+	 */
+	void grid(const nt::Rect &inner, std::vector<nt::Rect> &rects);
+
+	/*! \brief      Computes the areas of an Anchor layout
+	 *  \details    Must be called with _mutex held.
+	 *  \param      inner   Area inside the margin
+	 *  \param      rects   Areas of the items
+	 */
+	void anchor(const nt::Rect &inner, std::vector<nt::Rect> &rects) const;
+
+	/*! \brief      Shares the free space between the spans
+	 *  \param      spans       Spans (sizes are updated)
+	 *  \param      available   Space for all spans
+	 */
+	static void distribute(std::vector<Span> &spans, int available);
+
+	/*! \brief      Finds an item
+	 *  \details    Must be called with _mutex held.
+	 *  \param      object  Widget (nullptr - layout)
+	 *  \param      layout  Layout (nullptr - widget)
+	 *  \return     Item or nullptr if none
+	 */
+	Item *find(const NTGraphicObject *object, const NTLayout *layout);
+
+	mutable std::mutex _mutex;		/*!< Guards the items */
+	Kind _kind;						/*!< Placement of the items */
+	std::vector<Item> _items;		/*!< Items in order */
+	int _spacing;					/*!< Cells between neighbour items */
+	int _margin;					/*!< Cells from the edges of the area */
+	unsigned int _columns;			/*!< Items in a row of a Grid layout */
+	bool _dirty;					/*!< Areas must be computed again */
+	bool _placed;					/*!< Areas were computed at least once */
+	nt::Size _natural;				/*!< Content size of the layout */
+	nt::Rect _rect;					/*!< Area of the last pass */
+	size_t _computed;				/*!< Layouts computed by the last apply() */
+	std::vector<Span> _columnSpans;	/*!< Scratch spans of columns (main direction of a box) */
+	std::vector<Span> _rowSpans;	/*!< Scratch spans of rows */
+};
+
+#endif // _NTLAYOUT_H_
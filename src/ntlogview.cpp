@@ -0,0 +1,343 @@
+/*!	\file		ntlogview.cpp
+ *	\brief		Implementation of thread-safe NTLogView class
+ *	\details	Contains method implementations for log tail views in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntlogview.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Memory copy */
+#include <cstring>
+
+// Default constructor
+NTLogView::NTLogView(NTObject *parent, const std::string &name)
+	: NTLogView(parent, name, 0, 0, 0, 0)
+{
+}
+
+// Parameterized constructor
+NTLogView::NTLogView(NTObject *parent, const std::string &name, int x, int y,
+					 unsigned int width, unsigned int height,
+					 size_t capacity, size_t lineBytes)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the viewport
+	0,								// Color pair
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_capacity(nt::powerOfTwo(std::max<size_t>(capacity, 1))),
+	_lineWords(std::max<size_t>((lineBytes + 7) / 8, 1)),
+	_head(0),
+	_width(width), _height(height), _paused(false), _anchor(0),
+	_drawn(false), _drawnArea({0, 0, 0, 0}), _drawnEnd(0)
+{
+	_slots = std::make_unique<Slot[]>(_capacity);
+	_words = std::make_unique<std::atomic<uint64_t>[]>(_capacity * _lineWords);
+}
+
+// Destructor
+NTLogView::~NTLogView() = default;
+
+// Appends lines
+void NTLogView::append(std::string_view text)
+{
+	while (!text.empty()) {
+		size_t end = text.find('\n');
+		std::string_view line = text.substr(0, end);
+		write(_head.fetch_add(1, std::memory_order_relaxed), line);
+		if (end == std::string_view::npos) break;
+		text.remove_prefix(end + 1);
+	}
+}
+
+// Gets the number of lines appended so far
+uint64_t NTLogView::appended() const
+{
+	return _head.load(std::memory_order_relaxed);
+}
+
+// Gets the number of lines kept in the ring
+size_t NTLogView::capacity() const
+{
+	return _capacity;
+}
+
+// Sets the viewport size
+void NTLogView::setSize(unsigned int width, unsigned int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_width = width;
+	_height = height;
+	_changed = true;
+	placed();
+}
+
+// Moves and resizes the view to an area of a layout
+bool NTLogView::setGeometry(const nt::Rect &rect)
+{
+	setPosition(rect.x, rect.y);
+	nt::Rect current = bounds();
+	if (current.width != rect.width || current.height != rect.height) {
+		setSize(static_cast<unsigned int>(std::max(rect.width, 0)),
+				static_cast<unsigned int>(std::max(rect.height, 0)));
+	}
+	return true;
+}
+
+// Gets the viewport width
+unsigned int NTLogView::width() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _width;
+}
+
+// Gets the viewport height
+unsigned int NTLogView::height() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _height;
+}
+
+// Freezes the view at the current tail
+void NTLogView::pause()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_paused) return;
+	_anchor = tail();
+	_paused = true;
+}
+
+// Follows the tail again
+void NTLogView::resume()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_paused) return;
+	_paused = false;
+	_changed = true;
+}
+
+// Checks if the view is frozen
+bool NTLogView::isPaused() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _paused;
+}
+
+// Scrolls the view
+void NTLogView::scrollBy(long rows)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_paused && rows >= 0) return;	// already at the tail
+
+	uint64_t anchor = _paused ? _anchor : tail();
+	anchor = rows < 0 ? anchor - std::min(anchor, static_cast<uint64_t>(-rows))
+					  : anchor + static_cast<uint64_t>(rows);
+	_anchor = keep(anchor);
+	_paused = true;
+	_changed = true;
+}
+
+// Forces a full redraw on the next draw()
+void NTLogView::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_drawn = false;
+	_changed = true;
+}
+
+// Gets the area covered by the viewport
+nt::Rect NTLogView::area() const
+{
+	return {_x, _y, static_cast<int>(_width), static_cast<int>(_height)};
+}
+
+// Checks if new lines arrived or the view changed
+bool NTLogView::dirty() const
+{
+	return _changed || (!_paused && _head.load(std::memory_order_relaxed) != _drawnEnd);
+}
+
+// Lines are padded, so the view hides what is below it
+bool NTLogView::opaque() const
+{
+	return !(_ntattr & NTA_SPACE_TRANSPARENT);
+}
+
+// Writes one line to its slot
+void NTLogView::write(uint64_t ticket, std::string_view line)
+{
+	Slot &slot = _slots[ticket & (_capacity - 1)];
+	uint64_t busy = 2 * ticket + 1;
+
+	// Take the slot unless a newer line already has it
+	uint64_t current = slot.sequence.load(std::memory_order_relaxed);
+	for (;;) {
+		if (current >= busy) return;	// lapped: the line is overwritten anyway
+		if (current & 1) {				// a producer one lap earlier still writes it
+			current = slot.sequence.load(std::memory_order_relaxed);
+			continue;
+		}
+		if (slot.sequence.compare_exchange_weak(current, busy, std::memory_order_relaxed)) break;
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+
+	// Cut the line at a glyph boundary
+	size_t length = std::min(line.size(), _lineWords * 8);
+	if (length < line.size()) {
+		while (length > 0 && (static_cast<unsigned char>(line[length]) & 0xC0) == 0x80) length--;
+	}
+
+	std::atomic<uint64_t> *words = &_words[(ticket & (_capacity - 1)) * _lineWords];
+	for (size_t offset = 0; offset < length; offset += 8) {
+		uint64_t word = 0;
+		std::memcpy(&word, line.data() + offset, std::min<size_t>(8, length - offset));
+		words[offset / 8].store(word, std::memory_order_relaxed);
+	}
+	slot.length.store(static_cast<uint32_t>(length), std::memory_order_relaxed);
+
+	slot.sequence.store(busy + 1, std::memory_order_release);
+}
+
+// Reads one line from its slot
+bool NTLogView::read(uint64_t ticket, std::string &line) const
+{
+	const Slot &slot = _slots[ticket & (_capacity - 1)];
+	uint64_t done = 2 * ticket + 2;
+	if (slot.sequence.load(std::memory_order_acquire) != done) return false;
+
+	size_t length = std::min<size_t>(slot.length.load(std::memory_order_relaxed), _lineWords * 8);
+	line.resize(length);
+	const std::atomic<uint64_t> *words = &_words[(ticket & (_capacity - 1)) * _lineWords];
+	for (size_t offset = 0; offset < length; offset += 8) {
+		uint64_t word = words[offset / 8].load(std::memory_order_relaxed);
+		std::memcpy(&line[offset], &word, std::min<size_t>(8, length - offset));
+	}
+
+	// The slot must not have been taken by a newer line meanwhile
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return slot.sequence.load(std::memory_order_relaxed) == done;
+}
+
+// Gets the end of the complete lines of the tail
+uint64_t NTLogView::tail() const
+{
+	uint64_t end = _head.load(std::memory_order_acquire);
+	uint64_t rows = std::min<uint64_t>(_height, _capacity);
+
+	// Walk back over the rows of the viewport; a line still being written
+	// ends the tail before it
+	uint64_t ticket = end;
+	while (ticket > 0 && end - ticket < rows) {
+		ticket--;
+		uint64_t sequence = _slots[ticket & (_capacity - 1)].sequence.load(std::memory_order_acquire);
+		if (sequence < 2 * ticket + 2) end = ticket;
+	}
+	return end;
+}
+
+// Keeps a frozen view inside the lines kept in the ring
+uint64_t NTLogView::keep(uint64_t anchor) const
+{
+	uint64_t end = tail();
+	uint64_t oldest = end > _capacity ? end - _capacity : 0;
+	uint64_t lowest = std::min<uint64_t>(oldest + _height, end);
+	return std::clamp(anchor, lowest, end);
+}
+
+// Draws one row of the viewport
+int NTLogView::drawRow(unsigned int row, uint64_t end, int max_x)
+{
+	int result = NT_OK;
+	int y = _y + static_cast<int>(row);
+
+	// Rows above the first line are empty, lost lines too
+	_line.clear();
+	if (end + row >= _height) {
+		uint64_t ticket = end + row - _height;
+		if (!read(ticket, _line)) _line.clear();
+	}
+	_layout.assign(_line);
+
+	int columns = std::min(static_cast<int>(_layout.columns), static_cast<int>(_width));
+	if (columns > 0 && drawColumns(y, _x, _line, _layout, 0, columns, max_x) == ERR) result = ERR;
+
+	// Padding
+	for (int i = std::max(columns, -_x); i < static_cast<int>(_width) && _x + i < max_x; i++) {
+		if (drawGlyph(y, _x + i, " ", 1) == ERR) result = ERR;
+	}
+
+	return result;
+}
+
+// Draws the new lines
+int NTLogView::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + static_cast<int>(_height) <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + static_cast<int>(_width) <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	nt::Rect view = area();
+	int height = view.height;
+	uint64_t end = _paused ? (_anchor = keep(_anchor)) : tail();
+	// A screen cleared the whole view (dirtyArea()), so all of it is drawn
+	bool full = _occlusion || !_drawn || view != _drawnArea;
+
+	// Lines arrived: shift what is on the screen and draw only the new rows,
+	// however many lines were appended since the last frame
+	int from = 0, to = 0;
+	if (!full && end != _drawnEnd) {
+		uint64_t distance = end > _drawnEnd ? end - _drawnEnd : _drawnEnd - end;
+		int rows = distance < static_cast<uint64_t>(height) ? static_cast<int>(distance) : height;
+		if (end < _drawnEnd) rows = -rows;
+		if (rows != height && rows != -height && shiftArea(view, rows)) {
+			from = rows > 0 ? height - rows : 0;
+			to = rows > 0 ? height : -rows;
+		} else {
+			full = true;
+		}
+	}
+	if (full) {
+		from = 0;
+		to = height;
+	}
+
+	for (int row = from; row < to; row++) {
+		int y = _y + row;
+		if (y < 0 || y >= max_y) continue;
+		if (drawRow(static_cast<unsigned int>(row), end, max_x) == ERR) result = ERR;
+	}
+
+	// Remember what is on the screen
+	_drawn = true;
+	_drawnArea = view;
+	_drawnEnd = end;
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
@@ -0,0 +1,228 @@
+/*! \file       ntlogview.h
+ *  \brief      NT Log view module (header file).
+ *  \details    Contains the NTLogView class definitions: tail of a log kept
+ *              in a fixed-capacity ring buffer with lock-free appends.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTLOGVIEW_H_
+#define _NTLOGVIEW_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard string view */
+#include <string_view>
+/*! \brief  Standard smart pointers */
+#include <memory>
+/*! \brief  Atomic operations */
+#include <atomic>
+/*! \brief  Fixed width integers */
+#include <cstdint>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+/*! \class      NTLogView
+ *  \brief      Log tail widget.
+ *  \details    Lines are kept in a ring of a fixed number of slots of a fixed
+ *              size, so appending never allocates. append() is lock-free and
+ *              may be called from any number of threads: a producer takes a
+ *              ticket with one atomic add and writes its slot under a
+ *              per-slot sequence number (a producer waits only for another
+ *              producer still writing the same slot one lap earlier). Lines
+ *              longer than a slot are cut.
+ *
+ *              Rendering is coalesced: draw() reads only the lines that fit
+ *              the viewport, so 100k appends between two frames cost one
+ *              shift of the screen (or one redraw) plus the visible tail.
+ *              pause() and scrollBy() freeze the view or move it back in the
+ *              ring while producers keep appending.
+ *  \extends    NTGraphicObject
+ */
+class NTLogView : public NTGraphicObject
+{
+public:
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    View name (default: empty string)
+	 */
+	NTLogView(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent      Pointer to the parent object
+	 *  \param      name        View name
+	 *  \param      x           X coordinate of the viewport
+	 *  \param      y           Y coordinate of the viewport
+	 *  \param      width       Viewport width
+	 *  \param      height      Viewport height
+	 *  \param      capacity    Lines kept (rounded up to a power of two)
+	 *  \param      lineBytes   Bytes kept per line (rounded up to 8)
+	 */
+	NTLogView(NTObject *parent, const std::string &name, int x, int y,
+			  unsigned int width, unsigned int height,
+			  size_t capacity = 4096, size_t lineBytes = 256);
+
+	/*! \brief  Destructor */
+	~NTLogView();
+
+	NTLogView(const NTLogView&) = delete;
+	NTLogView& operator=(const NTLogView&) = delete;
+
+	/*! \brief      Appends lines
+	 *  \details    Lock-free, may be called from any thread. The text is
+	 *              split at '\n'.
+	 *  \param      text    UTF-8 text
+	 */
+	void append(std::string_view text);
+
+	/*! \brief      Gets the number of lines appended so far
+	 *  \return     Number of lines
+	 */
+	uint64_t appended() const;
+
+	/*! \brief      Gets the number of lines kept in the ring
+	 *  \return     Ring capacity in lines
+	 */
+	size_t capacity() const;
+
+	/*! \brief      Sets the viewport size
+	 *  \param      width   Viewport width
+	 *  \param      height  Viewport height
+	 */
+	void setSize(unsigned int width, unsigned int height);
+
+	/*! \brief      Moves and resizes the view to an area of a layout
+	 *  \param      rect    Assigned area
+	 *  \return     true
+	 */
+	bool setGeometry(const nt::Rect &rect) override;
+
+	/*! \brief      Gets the viewport width
+	 *  \return     Width in columns
+	 */
+	unsigned int width() const;
+
+	/*! \brief      Gets the viewport height
+	 *  \return     Height in rows
+	 */
+	unsigned int height() const;
+
+	/*! \brief  Freezes the view at the current tail */
+	void pause();
+
+	/*! \brief  Follows the tail again */
+	void resume();
+
+	/*! \brief      Checks if the view is frozen
+	 *  \return     true if paused, false if following the tail
+	 */
+	bool isPaused() const;
+
+	/*! \brief      Scrolls the view
+	 *  \details    Scrolling back pauses the view. The view stays inside
+	 *              the lines kept in the ring.
+	 *  \param      rows    Rows to scroll down (negative - back)
+	 */
+	void scrollBy(long rows);
+
+	/*! \brief      Forces a full redraw on the next draw() */
+	void invalidate() override;
+
+	/*! \brief     Draws the new lines
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the viewport
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Checks if new lines arrived or the view changed
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if changed, false otherwise
+	 */
+	bool dirty() const override;
+
+	/*! \brief      Lines are padded, so the view hides what is below it
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true unless spaces are transparent
+	 */
+	bool opaque() const override;
+
+private:
+	/*!	\brief	Header of one slot of the ring */
+	struct Slot {
+		std::atomic<uint64_t> sequence{0};	/*!< 2 * ticket + 1 while written, 2 * ticket + 2 when done */
+		std::atomic<uint32_t> length{0};	/*!< Line length in bytes */
+	};
+
+	/*! \brief      Writes one line to its slot
+	 *  \param      ticket  Line number
+	 *  \param      line    UTF-8 text (cut to the slot size)
+	 */
+	void write(uint64_t ticket, std::string_view line);
+
+	/*! \brief      Reads one line from its slot
+	 *  \param      ticket  Line number
+	 *  \param      line    Text of the line
+	 *  \return     true if read, false if the line is not written yet or
+	 *              was overwritten
+	 */
+	bool read(uint64_t ticket, std::string &line) const;
+
+	/*! \brief      Gets the end of the complete lines of the tail
+	 *  \details    Must be called with _mutex held. Lines still written by
+	 *              producers are left for the next frame.
+	 *  \return     Line number after the last line to show
+	 */
+	uint64_t tail() const;
+
+	/*! \brief      Keeps a frozen view inside the lines kept in the ring
+	 *  \details    Must be called with _mutex held.
+	 *  \param      anchor  Line after the last one of the view
+	 *  \return     Anchor moved to the kept lines
+	 */
+	uint64_t keep(uint64_t anchor) const;
+
+	/*! \brief      Draws one row of the viewport
+	 *  \details    Must be called with _mutex held.
+	 *  \param      row     Viewport row
+	 *  \param      end     Line number after the last line of the viewport
+	 *  \param      max_x   Terminal width
+	 *  \return     OK if success, ERR if other error occurred
+	 */
+	int drawRow(unsigned int row, uint64_t end, int max_x);
+
+	std::unique_ptr<Slot[]> _slots;					/*!< Slot headers */
+	std::unique_ptr<std::atomic<uint64_t>[]> _words;	/*!< Slot text, _lineWords words per slot */
+	size_t _capacity;								/*!< Number of slots (power of two) */
+	size_t _lineWords;								/*!< Words per slot */
+	std::atomic<uint64_t> _head;					/*!< Tickets taken by producers */
+
+	unsigned int _width;				/*!< Viewport width */
+	unsigned int _height;				/*!< Viewport height */
+	bool _paused;						/*!< View is frozen */
+	uint64_t _anchor;					/*!< Line after the last one of a frozen view */
+	std::string _line;					/*!< Line being drawn (kept to reuse the memory) */
+	nt::TextLayout _layout;				/*!< Column map of the line being drawn */
+
+	bool _drawn;						/*!< Viewport is on the screen */
+	nt::Rect _drawnArea;				/*!< Viewport on the screen */
+	uint64_t _drawnEnd;					/*!< Line after the last one on the screen */
+};
+
+#endif // _NTLOGVIEW_H_
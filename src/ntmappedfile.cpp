@@ -0,0 +1,75 @@
+/*!	\file		ntmappedfile.cpp
+ *	\brief		Implementation of the NTMappedFile class
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntmappedfile.h"
+
+/*! \brief  POSIX file control */
+#include <fcntl.h>
+/*! \brief  POSIX memory mapping */
+#include <sys/mman.h>
+/*! \brief  POSIX file status */
+#include <sys/stat.h>
+/*! \brief  POSIX close() */
+#include <unistd.h>
+
+// Default constructor
+NTMappedFile::NTMappedFile() : _addr(nullptr), _size(0) {}
+
+// Destructor
+NTMappedFile::~NTMappedFile()
+{
+	close();
+}
+
+// Maps the file
+int NTMappedFile::open(const std::string &path)
+{
+	close();
+
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) return NT_ERR;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		::close(fd);
+		return NT_ERR;
+	}
+
+	// Empty file has nothing to map
+	if (st.st_size == 0) {
+		::close(fd);
+		return NT_OK;
+	}
+
+	void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (addr == MAP_FAILED) return NT_ERR;
+
+	_addr = addr;
+	_size = st.st_size;
+	return NT_OK;
+}
+
+// Unmaps the file
+void NTMappedFile::close()
+{
+	if (_addr) munmap(_addr, _size);
+	_addr = nullptr;
+	_size = 0;
+}
+
+// Gets the mapped data
+const char *NTMappedFile::data() const
+{
+	return static_cast<const char *>(_addr);
+}
+
+// Gets the mapped size
+size_t NTMappedFile::size() const
+{
+	return _size;
+}
@@ -0,0 +1,62 @@
+/*! \file       ntmappedfile.h
+ *  \brief      NT Mapped file module (header file).
+ *  \details    Contains the NTMappedFile class definitions for read-only
+ *              memory-mapped files in the NT system.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTMAPPEDFILE_H_
+#define _NTMAPPEDFILE_H_
+
+/*! \brief  Standard size types */
+#include <cstddef>
+/*! \brief  Standard string library */
+#include <string>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+
+/*! \class      NTMappedFile
+ *  \brief      Read-only memory mapping of a file.
+ *  \details    The mapping is shared (MAP_SHARED), so processes mapping the
+ *              same file share its page cache pages.
+ */
+class NTMappedFile
+{
+public:
+	/*! \brief  Default constructor */
+	NTMappedFile();
+
+	/*! \brief  Destructor (unmaps the file) */
+	~NTMappedFile();
+
+	NTMappedFile(const NTMappedFile&) = delete;
+	NTMappedFile& operator=(const NTMappedFile&) = delete;
+
+	/*! \brief      Maps the file
+	 *  \param      path    Path to the file
+	 *  \return     NT_OK if success (an empty file maps to no data), NT_ERR otherwise
+	 */
+	int open(const std::string &path);
+
+	/*! \brief  Unmaps the file */
+	void close();
+
+	/*! \brief      Gets the mapped data
+	 *  \return     Pointer to the first byte or nullptr if nothing is mapped
+	 */
+	const char *data() const;
+
+	/*! \brief      Gets the mapped size
+	 *  \return     Size in bytes
+	 */
+	size_t size() const;
+
+private:
+	void *_addr;	/*!< Mapping address (nullptr if not mapped) */
+	size_t _size;	/*!< Mapping size */
+};
+
+#endif // _NTMAPPEDFILE_H_
@@ -8,9 +8,9 @@
 #include "ntobject.h"
 
 // Constructor
-NTObject::NTObject(NTObject *parent, const std::string &name) :
+NTObject::NTObject(NTObject *parent, const std::string &name, std::pmr::memory_resource *resource) :
     _parent(parent),
-    _name(name)
+    _name(name, resource)
 {
     // Initialization handled in member initializer list
 }
@@ -42,5 +42,5 @@ void NTObject::setName(const std::string &name)
 // Gets the object name
 std::string NTObject::name() const
 {
-    return _name;
+    return std::string(_name);
 }
@@ -15,6 +15,8 @@
 #include <string>
 /*!	\brief	Standard functional library (for std::function) */
 #include <functional>
+/*!	\brief	Polymorphic memory resources */
+#include <memory_resource>
 
 /*!	\brief	Base NT types */
 #include "nttypes.h"
@@ -29,8 +31,10 @@ public:
 	/*!	\brief		Constructor
 	 *	\param		parent	Pointer to the parent object (default: nullptr)
 	 *	\param		name	Object name (default: empty string)
+	 *	\param		resource	Memory resource for the name (default: heap)
 	 */
-	NTObject(NTObject *parent = nullptr, const std::string &name = "");
+	NTObject(NTObject *parent = nullptr, const std::string &name = "",
+			 std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	/*!	\brief	Virtual destructor to allow proper inheritance */
 	~NTObject();
@@ -84,7 +88,7 @@ public:
 
 private:
 	NTObject *_parent;		/*!< Pointer to parent object */
-	std::string _name;		/*!< Object name */
+	std::pmr::string _name;	/*!< Object name */
 
 	/*!	\brief		List of observer callbacks
 	 *	\details	Marked as mutable to allow modification even in const methods
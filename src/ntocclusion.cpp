@@ -0,0 +1,98 @@
+/*!	\file		ntocclusion.cpp
+ *	\brief		Implementation of the NTOcclusion class
+ *	\details	Contains method implementations for occlusion maps in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntocclusion.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+// Constructor
+NTOcclusion::NTOcclusion() : _width(0), _height(0) {}
+
+// Starts a new frame with every cell clean
+void NTOcclusion::reset(int width, int height)
+{
+	_width = std::max(width, 0);
+	_height = std::max(height, 0);
+	_owners.assign(static_cast<size_t>(_width) * _height, CLEAN);
+}
+
+// Marks the area damaged
+void NTOcclusion::damage(const nt::Rect &area)
+{
+	nt::Rect rect = clip(area);
+	for (int y = rect.y; y < rect.y + rect.height; y++) {
+		int *row = &_owners[static_cast<size_t>(y) * _width];
+		std::fill(row + rect.x, row + rect.x + rect.width, NONE);
+	}
+}
+
+// Covers the damaged cells of the area with an opaque widget
+void NTOcclusion::cover(const nt::Rect &area, int depth)
+{
+	nt::Rect rect = clip(area);
+	for (int y = rect.y; y < rect.y + rect.height; y++) {
+		int *row = &_owners[static_cast<size_t>(y) * _width];
+		for (int x = rect.x; x < rect.x + rect.width; x++) {
+			if (row[x] != CLEAN) row[x] = depth;
+		}
+	}
+}
+
+// Checks if no cell of the area can be drawn by a widget
+bool NTOcclusion::hidden(const nt::Rect &area, int depth) const
+{
+	nt::Rect rect = clip(area);
+	for (int y = rect.y; y < rect.y + rect.height; y++) {
+		const int *row = &_owners[static_cast<size_t>(y) * _width];
+		for (int x = rect.x; x < rect.x + rect.width; x++) {
+			if (row[x] <= depth) return false;
+		}
+	}
+	return true;
+}
+
+// Marks clean the cells a widget of the parent map can not draw
+void NTOcclusion::restrict(const NTOcclusion &parent, int depth)
+{
+	for (int y = 0; y < _height; y++) {
+		int *row = &_owners[static_cast<size_t>(y) * _width];
+		for (int x = 0; x < _width; x++) {
+			if (row[x] != CLEAN && !parent.visible(x, y, depth)) row[x] = CLEAN;
+		}
+	}
+}
+
+// Checks if the cell is damaged and no opaque widget covers it
+bool NTOcclusion::bare(int x, int y) const
+{
+	if (x < 0 || y < 0 || x >= _width || y >= _height) return false;
+	return _owners[static_cast<size_t>(y) * _width + x] == NONE;
+}
+
+// Gets the screen width
+int NTOcclusion::width() const
+{
+	return _width;
+}
+
+// Gets the screen height
+int NTOcclusion::height() const
+{
+	return _height;
+}
+
+// Clips the area to the screen
+nt::Rect NTOcclusion::clip(const nt::Rect &area) const
+{
+	int x0 = std::max(area.x, 0);
+	int y0 = std::max(area.y, 0);
+	int x1 = std::min(area.x + area.width, _width);
+	int y1 = std::min(area.y + area.height, _height);
+	return {x0, y0, std::max(x1 - x0, 0), std::max(y1 - y0, 0)};
+}
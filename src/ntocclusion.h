@@ -0,0 +1,111 @@
+/*! \file       ntocclusion.h
+ *  \brief      NT Occlusion module (header file).
+ *  \details    Contains the NTOcclusion class definitions: per-cell map of
+ *              the top-most opaque widget used to skip hidden cells.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTOCCLUSION_H_
+#define _NTOCCLUSION_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Numeric limits */
+#include <climits>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+
+/*! \class      NTOcclusion
+ *  \brief      Occlusion map of one frame.
+ *  \details    Keeps for every screen cell the depth of the top-most opaque
+ *              widget that covers it. A widget at depth d may draw a cell
+ *              only if the value of the cell is not above d. Cells outside
+ *              the damaged areas hold CLEAN, so nothing is drawn there.
+ */
+class NTOcclusion
+{
+public:
+	static constexpr int NONE = -1;			/*!< Damaged cell not covered by an opaque widget */
+	static constexpr int CLEAN = INT_MAX;	/*!< Cell that does not need drawing */
+
+	/*! \brief  Constructor */
+	NTOcclusion();
+
+	/*! \brief      Starts a new frame with every cell clean
+	 *  \param      width   Screen width
+	 *  \param      height  Screen height
+	 */
+	void reset(int width, int height);
+
+	/*! \brief      Marks the area damaged
+	 *  \param      area    Screen area
+	 */
+	void damage(const nt::Rect &area);
+
+	/*! \brief      Covers the damaged cells of the area with an opaque widget
+	 *  \details    Widgets must be covered from the bottom up.
+	 *  \param      area    Bounds of the widget
+	 *  \param      depth   Depth of the widget
+	 */
+	void cover(const nt::Rect &area, int depth);
+
+	/*! \brief      Checks if the cell can be drawn by a widget
+	 *  \param      x       X coordinate of the cell
+	 *  \param      y       Y coordinate of the cell
+	 *  \param      depth   Depth of the widget
+	 *  \return     true if the cell is damaged and not covered from above
+	 */
+	bool visible(int x, int y, int depth) const
+	{
+		if (x < 0 || y < 0 || x >= _width || y >= _height) return false;
+		return _owners[static_cast<size_t>(y) * _width + x] <= depth;
+	}
+
+	/*! \brief      Checks if no cell of the area can be drawn by a widget
+	 *  \param      area    Bounds of the widget
+	 *  \param      depth   Depth of the widget
+	 *  \return     true if the widget is hidden
+	 */
+	bool hidden(const nt::Rect &area, int depth) const;
+
+	/*! \brief      Marks clean the cells a widget of the parent map can not draw
+	 *  \details    Used by containers: the children of a widget are drawn
+	 *              with a map of their own, limited by the map of the frame.
+	 *  \param      parent  Map the container is drawn with
+	 *  \param      depth   Depth of the container in the parent map
+	 */
+	void restrict(const NTOcclusion &parent, int depth);
+
+	/*! \brief      Checks if the cell is damaged and no opaque widget covers it
+	 *  \param      x   X coordinate of the cell
+	 *  \param      y   Y coordinate of the cell
+	 *  \return     true if the background shows through
+	 */
+	bool bare(int x, int y) const;
+
+	/*! \brief      Gets the screen width
+	 *  \return     Width in columns
+	 */
+	int width() const;
+
+	/*! \brief      Gets the screen height
+	 *  \return     Height in rows
+	 */
+	int height() const;
+
+private:
+	/*! \brief      Clips the area to the screen
+	 *  \param      area    Screen area
+	 *  \return     Visible part (may be empty)
+	 */
+	nt::Rect clip(const nt::Rect &area) const;
+
+	int _width;					/*!< Screen width */
+	int _height;				/*!< Screen height */
+	std::vector<int> _owners;	/*!< Depth of the top-most opaque widget per cell */
+};
+
+#endif // _NTOCCLUSION_H_
@@ -0,0 +1,140 @@
+/*!	\file		ntpack.cpp
+ *	\brief		Asset pack builder tool
+ *	\details	Builds NT asset packs from text art files and the built-in digit fonts,
+ *			and checks existing packs.
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "nttypes.h"
+#include "ntassetpack.h"
+#include "ntimagefile.h"
+#include "digits_8x8.h"
+#include "digits_16x16.h"
+
+// Prints the usage
+static void usage()
+{
+	std::cerr << "Usage: ntpack -o <pack> [--digits] [name=file[:image|font|sprite]]..." << std::endl
+			  << "       ntpack -c <pack>" << std::endl
+			  << "  -o <pack>   build the pack" << std::endl
+			  << "  --digits    add the built-in digits_8x8 and digits_16x16 fonts" << std::endl
+			  << "  name=file   add a text art file (frames split by \"---\" lines)" << std::endl
+			  << "  -c <pack>   verify the pack and list its assets" << std::endl;
+}
+
+// Compares the font glyphs in the pack with the built-in images
+static bool sameGlyphs(const NTAssetPack &pack, const std::string &font,
+					   const std::vector<nt::Image> &digits)
+{
+	for (size_t i = 0; i < digits.size(); i++) {
+		auto glyph = pack.glyph(font, U'0' + i);
+		if (!glyph || glyph->load() != NT_OK || glyph->height() != digits[i].img.size()) return false;
+		for (unsigned int y = 0; y < glyph->height(); y++) {
+			if (glyph->row(y) != digits[i].img[y]) return false;
+		}
+	}
+	return true;
+}
+
+// Verifies the pack and lists its assets
+static int check(const std::string &path)
+{
+	static const char *kinds[] = {"image", "font", "sprite"};
+
+	NTAssetPack pack;
+	if (pack.open(path) != NT_OK) {
+		std::cerr << path << ": not an asset pack" << std::endl;
+		return EXIT_FAILURE;
+	}
+	if (pack.verify() != NT_OK) {
+		std::cerr << path << ": checksum mismatch" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < pack.count(); i++) {
+		const nt::PackEntry *entry = pack.entry(i);
+		std::cout << entry->name << "\t" << (entry->kind < 3 ? kinds[entry->kind] : "?")
+				  << "\t" << entry->frames << " x " << entry->width << "x" << entry->height
+				  << ((entry->flags & nt::ASSET_STYLE) ? "\tstyle" : "") << std::endl;
+	}
+
+	// Built-in fonts must match the compiled-in images
+	if ((pack.find("digits_8x8") >= 0 && !sameGlyphs(pack, "digits_8x8", digits_8x8)) ||
+		(pack.find("digits_16x16") >= 0 && !sameGlyphs(pack, "digits_16x16", digits_16x16))) {
+		std::cerr << path << ": digit glyphs differ from the built-in images" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string output;
+	NTAssetPackWriter writer;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+
+		if ((arg == "-o" || arg == "-c") && i + 1 < argc) {
+			if (arg == "-c") return check(argv[i + 1]);
+			output = argv[++i];
+		} else if (arg == "--digits") {
+			if (writer.add("digits_8x8", nt::ASSET_FONT, digits_8x8, U'0') != NT_OK ||
+				writer.add("digits_16x16", nt::ASSET_FONT, digits_16x16, U'0') != NT_OK) {
+				std::cerr << "Can not add the digit fonts" << std::endl;
+				return EXIT_FAILURE;
+			}
+		} else if (arg.find('=') != std::string::npos) {
+			std::string name = arg.substr(0, arg.find('='));
+			std::string file = arg.substr(arg.find('=') + 1);
+			uint16_t kind = nt::ASSET_IMAGE;
+
+			// Only a known kind suffix is split off; any other is an error
+			size_t colon = file.rfind(':');
+			if (colon != std::string::npos) {
+				std::string kind_name = file.substr(colon + 1);
+				if (kind_name == "image") kind = nt::ASSET_IMAGE;
+				else if (kind_name == "font") kind = nt::ASSET_FONT;
+				else if (kind_name == "sprite") kind = nt::ASSET_SPRITE;
+				else {
+					std::cerr << arg << ": unknown asset kind \"" << kind_name << "\"" << std::endl;
+					return EXIT_FAILURE;
+				}
+				file = file.substr(0, colon);
+			}
+
+			NTImageFile art;
+			if (art.open(file) != NT_OK || art.frameCount() == 0) {
+				std::cerr << file << ": can not read text art" << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			std::vector<nt::Image> frames;
+			for (size_t f = 0; f < art.frameCount(); f++) frames.push_back(art.image(f));
+			if (writer.add(name, kind, frames) != NT_OK) {
+				std::cerr << name << ": can not add the asset" << std::endl;
+				return EXIT_FAILURE;
+			}
+		} else {
+			usage();
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (output.empty()) {
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	if (writer.write(output) != NT_OK) {
+		std::cerr << output << ": can not write the pack" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
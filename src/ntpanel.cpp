@@ -0,0 +1,270 @@
+/*!	\file		ntpanel.cpp
+ *	\brief		Implementation of thread-safe NTPanel class
+ *	\details	Contains method implementations for cached panels in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntpanel.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+// Default constructor
+NTPanel::NTPanel(NTObject *parent, const std::string &name)
+	: NTPanel(parent, name, 0, 0, 0, 0)
+{
+}
+
+// Parameterized constructor
+NTPanel::NTPanel(NTObject *parent, const std::string &name, int x, int y,
+				 unsigned int width, unsigned int height)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate
+	0,								// Color pair (children have their own)
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_width(width), _height(height), _pad(nullptr), _composite(true),
+	_drawnArea({0, 0, 0, 0})
+{
+}
+
+// Destructor
+NTPanel::~NTPanel()
+{
+	if (_pad) delwin(_pad);
+}
+
+// Adds a child on top of the others
+void NTPanel::add(NTGraphicObject *child)
+{
+	_layer.add(child);
+}
+
+// Removes a child
+void NTPanel::remove(NTGraphicObject *child)
+{
+	_layer.remove(child);
+}
+
+// Sets the panel size
+void NTPanel::setSize(unsigned int width, unsigned int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_width = width;
+	_height = height;
+	_changed = true;
+	placed();
+}
+
+// Moves and resizes the panel to an area of a layout
+bool NTPanel::setGeometry(const nt::Rect &rect)
+{
+	setPosition(rect.x, rect.y);
+	nt::Rect current = bounds();
+	if (current.width != rect.width || current.height != rect.height) {
+		setSize(static_cast<unsigned int>(std::max(rect.width, 0)),
+				static_cast<unsigned int>(std::max(rect.height, 0)));
+	}
+	return true;
+}
+
+// Gets the panel width
+unsigned int NTPanel::width() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _width;
+}
+
+// Gets the panel height
+unsigned int NTPanel::height() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _height;
+}
+
+// Copies the whole layer on the next draw()
+void NTPanel::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_composite = true;
+	_changed = true;
+}
+
+// Renders all children into the layer on the next draw()
+void NTPanel::rebuild()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_layer.invalidate();
+	_composite = true;
+	_changed = true;
+}
+
+// Gets the area covered by the panel
+nt::Rect NTPanel::area() const
+{
+	return {_x, _y, static_cast<int>(_width), static_cast<int>(_height)};
+}
+
+// Gets the area of the changed children
+nt::Rect NTPanel::dirtyArea() const
+{
+	nt::Rect panel = area();
+	if (_changed || _composite) return panel;
+
+	nt::Rect rect = _layer.pending();
+	int x0 = std::max(rect.x, 0);
+	int y0 = std::max(rect.y, 0);
+	int x1 = std::min(rect.x + rect.width, panel.width);
+	int y1 = std::min(rect.y + rect.height, panel.height);
+	if (x1 <= x0 || y1 <= y0) return {_x, _y, 0, 0};
+	return {_x + x0, _y + y0, x1 - x0, y1 - y0};
+}
+
+// Checks if the panel or a child needs drawing
+bool NTPanel::dirty() const
+{
+	if (_changed || _composite) return true;
+	nt::Rect rect = _layer.pending();
+	return rect.width > 0 && rect.height > 0;
+}
+
+// The layer covers every cell of the panel
+bool NTPanel::opaque() const
+{
+	return true;
+}
+
+// The children are drawn into an ncurses pad
+bool NTPanel::serial() const
+{
+	return true;
+}
+
+// Copies a part of the layer to the window of the frame
+int NTPanel::composite(const nt::Rect &rect, int max_y, int max_x)
+{
+	int result = NT_OK;
+	WINDOW *target = window();
+
+	// Cells the frame allows: on the window and not covered from above
+	auto allowed = [&](int x, int y) {
+		return x >= 0 && x < max_x && (!_occlusion || _occlusion->visible(x, y, _depth));
+	};
+
+	int x0 = std::max(rect.x, 0);
+	int y0 = std::max(rect.y, 0);
+	int x1 = std::min(rect.x + rect.width, static_cast<int>(_width));
+	int y1 = std::min(rect.y + rect.height, static_cast<int>(_height));
+	for (int row = y0; row < y1; row++) {
+		int y = _y + row;
+		if (y < 0 || y >= max_y) continue;
+
+		// Copy the runs of allowed cells of the row
+		int column = x0;
+		while (column < x1) {
+			while (column < x1 && !allowed(_x + column, y)) column++;
+			int start = column;
+			while (column < x1 && allowed(_x + column, y)) column++;
+			if (column > start &&
+				copywin(_pad, target, row, start, y, _x + start, y, _x + column - 1, FALSE) == ERR) {
+				result = ERR;
+			}
+		}
+	}
+
+	return result;
+}
+
+// Copies a part of the layer to the frame buffer of the frame
+void NTPanel::rasterize(const nt::Rect &rect)
+{
+	int x0 = std::max(rect.x, 0);
+	int y0 = std::max(rect.y, 0);
+	int x1 = std::min(rect.x + rect.width, static_cast<int>(_width));
+	int y1 = std::min(rect.y + rect.height, static_cast<int>(_height));
+	for (int row = y0; row < y1; row++) {
+		for (int column = x0; column < x1; column++) {
+			NTFrameBuffer::Cell *cell = NTGraphicObject::_layer->at(_x + column, _y + row);
+			cchar_t input;
+			wchar_t text[CCHARW_MAX + 1] = {0};
+			attr_t attr;
+			short pair;
+			if (!cell || mvwin_wch(_pad, row, column, &input) == ERR ||
+				getcchar(&input, text, &attr, &pair, nullptr) == ERR) continue;
+
+			std::copy(text, text + CCHARW_MAX - 1, cell->text);
+			cell->text[CCHARW_MAX - 1] = 0;
+			cell->attr = attr & ~A_COLOR;
+			cell->pair = pair;
+			cell->flags = NTF_GLYPH | NTF_ATTR;
+
+			// Both columns of a wide glyph read the glyph: the right one becomes its continuation
+			if (wcwidth(text[0]) == 2 && column + 1 < x1) {
+				cell->flags |= NTF_WIDE;
+				NTFrameBuffer::Cell *next = NTGraphicObject::_layer->at(_x + ++column, _y + row);
+				if (!next) continue;
+				*next = *cell;
+				next->text[0] = 0;
+				next->flags = NTF_GLYPH | NTF_ATTR | NTF_CONTINUATION;
+			}
+		}
+	}
+}
+
+// Draws the changed children and copies the layer
+int NTPanel::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + static_cast<int>(_height) <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + static_cast<int>(_width) <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	// Layer of the panel size (a new layer draws all children)
+	int width = static_cast<int>(_width), height = static_cast<int>(_height);
+	if (!_pad || getmaxx(_pad) != width || getmaxy(_pad) != height) {
+		if (_pad) delwin(_pad);
+		_pad = newpad(height, width);
+		if (!_pad) return ERR;
+		_layer.setWindow(_pad);
+		_composite = true;
+	}
+
+	// A moved panel copies all of the layer
+	nt::Rect panel = area();
+	if (panel != _drawnArea) _composite = true;
+
+	// Draw the changed children into the layer, then copy what changed
+	if (_layer.draw() == ERR) result = ERR;
+	nt::Rect rect = _composite ? nt::Rect{0, 0, width, height} : _layer.damaged();
+	if (NTGraphicObject::_layer) rasterize(rect);
+	else if (composite(rect, max_y, max_x) == ERR) result = ERR;
+	_composite = false;
+	_drawnArea = panel;
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
@@ -0,0 +1,170 @@
+/*! \file       ntpanel.h
+ *  \brief      NT Panel module (header file).
+ *  \details    Contains the NTPanel class definitions: container that keeps
+ *              its children rendered in an ncurses pad of its own.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTPANEL_H_
+#define _NTPANEL_H_
+
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  Widget compositor */
+#include "ntscreen.h"
+
+/*! \class      NTPanel
+ *  \brief      Container with a cached layer.
+ *  \details    Children are drawn by an NTScreen into a pad of the panel, so
+ *              their coordinates are relative to the panel. Only changed
+ *              children are drawn into the pad, and only the changed part
+ *              of the pad is copied to the window the panel is drawn into
+ *              (copywin(), limited to the cells the occlusion map allows).
+ *              Under NTTileRenderer the cells of the pad are copied into the
+ *              frame buffer of the panel instead.
+ *
+ *              When the cells of the panel are overwritten (invalidate()),
+ *              the pad is copied again and the children are not drawn at
+ *              all: static chrome is rendered once and reused. rebuild()
+ *              renders the children again. Moving the panel only copies.
+ *
+ *              The panel does not own the children.
+ *  \extends    NTGraphicObject
+ */
+class NTPanel : public NTGraphicObject
+{
+public:
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    Panel name (default: empty string)
+	 */
+	NTPanel(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent  Pointer to the parent object
+	 *  \param      name    Panel name
+	 *  \param      x       X coordinate
+	 *  \param      y       Y coordinate
+	 *  \param      width   Width in columns
+	 *  \param      height  Height in rows
+	 */
+	NTPanel(NTObject *parent, const std::string &name, int x, int y,
+			unsigned int width, unsigned int height);
+
+	/*! \brief  Destructor */
+	~NTPanel();
+
+	NTPanel(const NTPanel&) = delete;
+	NTPanel& operator=(const NTPanel&) = delete;
+
+	/*! \brief      Adds a child on top of the others
+	 *  \param      child   Child widget (coordinates relative to the panel)
+	 */
+	void add(NTGraphicObject *child);
+
+	/*! \brief      Removes a child
+	 *  \param      child   Child widget
+	 */
+	void remove(NTGraphicObject *child);
+
+	/*! \brief      Sets the panel size
+	 *  \param      width   Width in columns
+	 *  \param      height  Height in rows
+	 */
+	void setSize(unsigned int width, unsigned int height);
+
+	/*! \brief      Moves and resizes the panel to an area of a layout
+	 *  \param      rect    Assigned area
+	 *  \return     true
+	 */
+	bool setGeometry(const nt::Rect &rect) override;
+
+	/*! \brief      Gets the panel width
+	 *  \return     Width in columns
+	 */
+	unsigned int width() const;
+
+	/*! \brief      Gets the panel height
+	 *  \return     Height in rows
+	 */
+	unsigned int height() const;
+
+	/*! \brief      Copies the whole layer on the next draw()
+	 *  \details    The children are not drawn again.
+	 */
+	void invalidate() override;
+
+	/*! \brief      Renders all children into the layer on the next draw() */
+	void rebuild();
+
+	/*! \brief     Draws the changed children and copies the layer
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the panel
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Gets the area of the changed children
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect dirtyArea() const override;
+
+	/*! \brief      Checks if the panel or a child needs drawing
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if changed, false otherwise
+	 */
+	bool dirty() const override;
+
+	/*! \brief      The layer covers every cell of the panel
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true
+	 */
+	bool opaque() const override;
+
+	/*! \brief      The children are drawn into an ncurses pad
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true
+	 */
+	bool serial() const override;
+
+private:
+	/*! \brief      Copies a part of the layer to the window of the frame
+	 *  \details    Must be called with _mutex held.
+	 *  \param      rect    Area of the layer (panel coordinates)
+	 *  \param      max_y   Window height
+	 *  \param      max_x   Window width
+	 *  \return     OK if success, ERR if other error occurred
+	 */
+	int composite(const nt::Rect &rect, int max_y, int max_x);
+
+	/*! \brief      Copies a part of the layer to the frame buffer of the frame
+	 *  \details    Must be called with _mutex held.
+	 *  \param      rect    Area of the layer (panel coordinates)
+	 */
+	void rasterize(const nt::Rect &rect);
+
+	unsigned int _width;	/*!< Width in columns */
+	unsigned int _height;	/*!< Height in rows */
+	WINDOW *_pad;			/*!< Layer of the children */
+	NTScreen _layer;		/*!< Compositor of the children */
+	bool _composite;		/*!< Whole layer must be copied */
+	nt::Rect _drawnArea;	/*!< Panel on the screen after the last draw */
+};
+
+#endif // _NTPANEL_H_
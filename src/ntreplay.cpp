@@ -0,0 +1,116 @@
+/*!	\file		ntreplay.cpp
+ *	\brief		Frame recording player tool
+ *	\details	Plays NT frame recordings on the terminal or headless, and reports
+ *			the throughput of the output.
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <clocale>
+#include <csignal>
+
+#include "nttypes.h"
+#include "ntcursessink.h"
+#include "ntframereplayer.h"
+#include "ntstreamsink.h"
+
+// Prints the usage
+static void usage()
+{
+	std::cerr << "Usage: ntreplay [-m] [-s <speed>] [-n | -o] <recording>" << std::endl
+			  << "  -m          play as fast as possible" << std::endl
+			  << "  -s <speed>  speed of the recorded times (default 1)" << std::endl
+			  << "  -n          headless: play to a terminal on /dev/null" << std::endl
+			  << "  -o          write a frame stream to the standard output (see ntview)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string path;
+	double speed = 1.0;
+	bool headless = false, stream = false;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "-m") {
+			speed = 0;
+		} else if (arg == "-s" && i + 1 < argc) {
+			speed = std::max(std::atof(argv[++i]), 0.0);
+		} else if (arg == "-n") {
+			headless = true;
+		} else if (arg == "-o") {
+			stream = true;
+		} else if (path.empty() && arg[0] != '-') {
+			path = arg;
+		} else {
+			usage();
+			return EXIT_FAILURE;
+		}
+	}
+	if (path.empty()) {
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	NTFrameReplayer replayer;
+	if (replayer.open(path) != NT_OK) {
+		std::cerr << path << ": not a frame recording" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Stream: the statistics go to the standard error
+	if (stream) {
+		signal(SIGPIPE, SIG_IGN);
+		NTStreamSink sink(STDOUT_FILENO, false, true);
+		int result = replayer.play(sink, speed);
+		NTFrameReplayer::Stats stats = replayer.stats();
+		std::cerr << stats.frames << " frames, " << sink.bytes() << " bytes streamed" << std::endl;
+		return result == NT_OK ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	setlocale(LC_ALL, "");
+	FILE *null = nullptr;
+	SCREEN *screen = nullptr;
+	if (headless) {
+		null = std::fopen("/dev/null", "w");
+		screen = null ? newterm(nullptr, null, stdin) : nullptr;
+		if (!screen) {
+			std::cerr << "Can not open a headless terminal" << std::endl;
+			return EXIT_FAILURE;
+		}
+	} else {
+		initscr();
+	}
+	curs_set(0);
+	if (has_colors()) {
+		start_color();
+		use_default_colors();
+	}
+
+	NTCursesSink sink(nullptr, screen);
+	int result = replayer.play(sink, speed);
+	endwin();
+	if (screen) delscreen(screen);
+	if (null) std::fclose(null);
+
+	NTFrameReplayer::Stats stats = replayer.stats();
+	double seconds = std::max(stats.elapsed.count() / 1e6, 1e-6);
+	std::cout << stats.frames << " frames in " << std::fixed << std::setprecision(3) << seconds << " s (recorded "
+			  << stats.recorded.count() / 1e6 << " s)" << std::endl
+			  << std::setprecision(1) << stats.frames / seconds << " frames/s, "
+			  << stats.cells / seconds << " cells/s decoded, "
+			  << stats.written / seconds << " cells/s written, "
+			  << stats.bytes / seconds / 1e6 << " MB/s" << std::endl;
+	if (result != NT_OK) {
+		std::cerr << path << ": playback failed" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,379 @@
+/*!	\file		ntscreen.cpp
+ *	\brief		Implementation of the NTScreen class
+ *	\details	Contains method implementations for the widget compositor in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntscreen.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Standard hash set */
+#include <unordered_set>
+
+/*! \brief  Terminal resize handling */
+#include "ntterminal.h"
+/*! \brief  Work-stealing task pool */
+#include "nttaskpool.h"
+/*! \brief  Widget layouts */
+#include "ntlayout.h"
+
+namespace {
+	// Grows the area to cover another one
+	void unite(nt::Rect &a, const nt::Rect &b)
+	{
+		if (b.width <= 0 || b.height <= 0) return;
+		if (a.width <= 0 || a.height <= 0) {
+			a = b;
+			return;
+		}
+		int x1 = std::max(a.x + a.width, b.x + b.width);
+		int y1 = std::max(a.y + a.height, b.y + b.height);
+		a.x = std::min(a.x, b.x);
+		a.y = std::min(a.y, b.y);
+		a.width = x1 - a.x;
+		a.height = y1 - a.y;
+	}
+}
+
+// Constructor
+NTScreen::NTScreen(WINDOW *window)
+	: _window(window), _mirrored(false), _layout(nullptr), _pool(nullptr), _full(true), _width(0), _height(0), _culled(0), _deferred(0),
+	_raster(0), _output(0), _damaged({0, 0, 0, 0}) {}
+
+// Destructor
+NTScreen::~NTScreen() = default;
+
+// Adds a widget on top of the others
+void NTScreen::add(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (const Item &item : _items) {
+		if (item.object == object) return;
+	}
+	_items.push_back({object, {0, 0, 0, 0}, false, NTP_NORMAL});
+	_index.insert(object);
+}
+
+// Removes a widget
+void NTScreen::remove(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = std::find_if(_items.begin(), _items.end(), [object](const Item &item) { return item.object == object; });
+	if (it == _items.end()) return;
+	if (it->shown) _damage.push_back({it->drawn, nullptr});
+	_items.erase(it);
+	_index.remove(object);
+}
+
+// Sets the priority of a widget
+void NTScreen::setPriority(NTGraphicObject *object, int priority)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (Item &item : _items) {
+		if (item.object == object) item.priority = priority;
+	}
+}
+
+// Gets the top-most widget that covers the cell
+NTGraphicObject *NTScreen::at(int x, int y) const
+{
+	return _index.at(x, y);
+}
+
+// Gets the spatial index of the widgets
+const NTSpatialIndex &NTScreen::index() const
+{
+	return _index;
+}
+
+// Sets the window to draw into
+void NTScreen::setWindow(WINDOW *window)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_window = window;
+	_full = true;
+}
+
+// Sets the task pool whose results are applied before every frame
+void NTScreen::setTaskPool(NTTaskPool *pool)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pool = pool;
+}
+
+// Redraws the whole screen on the next draw()
+void NTScreen::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_full = true;
+}
+
+// Attaches an output that mirrors the window
+void NTScreen::attach(NTFrameSink *sink)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!sink || std::find(_sinks.begin(), _sinks.end(), sink) != _sinks.end()) return;
+	sink->invalidate();
+	_sinks.push_back(sink);
+}
+
+// Detaches an output
+void NTScreen::detach(NTFrameSink *sink)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sinks.erase(std::remove(_sinks.begin(), _sinks.end(), sink), _sinks.end());
+}
+
+// Gets the area the next draw() will draw
+nt::Rect NTScreen::pending() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<Damage> damage;
+	collect(damage, INT_MIN, nullptr);
+	nt::Rect result = {0, 0, 0, 0};
+	for (const Damage &area : damage) unite(result, area.rect);
+	return result;
+}
+
+// Gets the area drawn by the last draw()
+nt::Rect NTScreen::damaged() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _damaged;
+}
+
+// Collects the damage of the next frame
+void NTScreen::collect(std::vector<Damage> &damage, int priority, std::vector<char> *deferred) const
+{
+	damage = _damage;
+	if (_full) damage.push_back({{0, 0, _width, _height}, nullptr});
+	if (deferred) deferred->assign(_items.size(), 0);
+	for (size_t i = 0; i < _items.size(); i++) {
+		const Item &item = _items[i];
+		std::lock_guard<std::mutex> object_lock(item.object->_mutex);
+		nt::Rect rect = item.object->area();
+		bool changed = !item.shown || rect != item.drawn || item.object->dirty();
+		if (changed && item.priority < priority) {
+			if (deferred) (*deferred)[i] = 1;
+		} else if (!item.shown) {
+			damage.push_back({rect, nullptr});
+		} else if (rect != item.drawn) {
+			damage.push_back({item.drawn, nullptr});
+			damage.push_back({rect, nullptr});
+		} else if (item.object->dirty()) {
+			damage.push_back({item.object->dirtyArea(), item.object});
+		}
+	}
+}
+
+// Sets the function called when the screen size changes
+void NTScreen::setResizeHandler(std::function<void(int, int)> handler)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_onResize = std::move(handler);
+}
+
+// Sets the layout of the widgets
+void NTScreen::setLayout(NTLayout *layout)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_layout = layout;
+}
+
+// Gets the screen width of the last frame
+int NTScreen::width() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _width;
+}
+
+// Gets the screen height of the last frame
+int NTScreen::height() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _height;
+}
+
+// Notifies the handler and the widgets of a new size
+void NTScreen::resize()
+{
+	std::function<void(int, int)> handler;
+	std::vector<NTGraphicObject *> objects;
+	int width, height;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		getmaxyx(_window ? _window : stdscr, height, width);
+		if (width == _width && height == _height) return;
+		_width = width;
+		_height = height;
+		_full = true;
+		handler = _onResize;
+		for (const Item &item : _items) objects.push_back(item.object);
+	}
+
+	if (handler) handler(width, height);
+	for (NTGraphicObject *object : objects) object->screenResized(width, height);
+}
+
+// Gets the number of widgets skipped as hidden in the last frame
+size_t NTScreen::culled() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _culled;
+}
+
+// Gets the number of widgets deferred by the last frame
+size_t NTScreen::deferred() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _deferred;
+}
+
+// Gets the time the last draw() spent drawing the widgets
+std::chrono::microseconds NTScreen::rasterTime() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _raster;
+}
+
+// Gets the time the last draw() spent writing to the terminal
+std::chrono::microseconds NTScreen::outputTime() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _output;
+}
+
+// Draws the damaged areas
+int NTScreen::draw(int priority)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	// Results of the widget tasks are applied together, before the frame
+	NTTaskPool *pool;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		pool = _pool;
+	}
+	if (pool) pool->publish();
+
+	// Terminal resized: lay out again before the frame (one full frame follows)
+	bool terminal;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		terminal = !_window;
+	}
+	if (terminal) NTTerminal::apply();
+	resize();
+
+	// Lay out what changed (the layout moves widgets, so it runs unlocked)
+	NTLayout *layout;
+	nt::Rect screen;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		layout = _layout;
+		screen = {0, 0, _width, _height};
+	}
+	if (layout) layout->apply(screen);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+	_culled = 0;
+	WINDOW *window = _window ? _window : stdscr;
+
+	// Collect the damage: changed areas, old and new bounds of moved widgets
+	std::vector<Damage> damage;
+	std::vector<char> deferred;
+	collect(damage, priority, &deferred);
+	_damage.clear();
+	_full = false;
+	_deferred = 0;
+	for (size_t i = 0; i < _items.size(); i++) {
+		if (deferred[i]) {
+			_deferred++;	// keeps its old bounds and changes until drawn
+			continue;
+		}
+		Item &item = _items[i];
+		std::lock_guard<std::mutex> object_lock(item.object->_mutex);
+		item.drawn = item.object->area();
+		item.shown = true;
+	}
+	_damaged = {0, 0, 0, 0};
+	for (const Damage &area : damage) unite(_damaged, area.rect);
+
+	_occlusion.reset(_width, _height);
+	for (const Damage &area : damage) _occlusion.damage(area.rect);
+
+	// Widgets that touch the damage
+	std::unordered_set<NTGraphicObject *> touched;
+	std::vector<NTGraphicObject *> found;
+	for (const Damage &area : damage) {
+		_index.query(area.rect, found);
+		touched.insert(found.begin(), found.end());
+	}
+
+	// Opaque widgets cover the cells below them (bottom up, the top-most wins)
+	std::vector<Layer> layers;
+	for (size_t i = 0; i < _items.size(); i++) {
+		NTGraphicObject *object = _items[i].object;
+		std::lock_guard<std::mutex> object_lock(object->_mutex);
+		if (!touched.count(object)) {
+			if (!deferred[i]) object->_changed = false;
+			continue;
+		}
+		nt::Rect rect = object->area();
+		if (object->opaque()) _occlusion.cover(rect, static_cast<int>(i));
+		layers.push_back({i, rect});
+	}
+
+	// Clear the damaged cells: cells of opaque widgets do not take the attrs left on them either
+	for (const Damage &area : damage) {
+		const nt::Rect &rect = area.rect;
+		int x1 = std::min(rect.x + rect.width, _width);
+		int y1 = std::min(rect.y + rect.height, _height);
+		for (int y = std::max(rect.y, 0); y < y1; y++) {
+			for (int x = std::max(rect.x, 0); x < x1; x++) mvwaddch(window, y, x, ' ');
+		}
+	}
+
+	// Draw the visible widgets from the bottom up, clipped to the damage
+	for (const Layer &layer : layers) {
+		NTGraphicObject *object = _items[layer.item].object;
+		int depth = static_cast<int>(layer.item);
+
+		if (_occlusion.hidden(layer.rect, depth)) {
+			std::lock_guard<std::mutex> object_lock(object->_mutex);
+			object->_changed = false;
+			_culled++;
+			continue;
+		}
+
+		// Widget redraws all of itself if other widgets damaged its cells
+		for (const Damage &area : damage) {
+			if (area.source != object && nt::overlaps(area.rect, layer.rect)) {
+				object->invalidate();
+				break;
+			}
+		}
+		if (NTGraphicObject::drawClipped(object, &_occlusion, depth, window) == ERR) result = ERR;
+	}
+
+	// Output once per frame: widgets drawn into stdscr do not refresh it themselves
+	auto drawn = std::chrono::steady_clock::now();
+	if (!_window) refresh();
+
+	// Mirrors: the window is read only if the frame changed it
+	if (_sinks.empty()) {
+		_mirrored = false;
+	} else {
+		if (!_mirrored || _damaged.width > 0) _mirror.capture(window);
+		_mirrored = true;
+		for (NTFrameSink *sink : _sinks) sink->present(_mirror);
+	}
+	auto end = std::chrono::steady_clock::now();
+	_raster = std::chrono::duration_cast<std::chrono::microseconds>(drawn - start);
+	_output = std::chrono::duration_cast<std::chrono::microseconds>(end - drawn);
+	return result;
+}
@@ -0,0 +1,275 @@
+/*! \file       ntscreen.h
+ *  \brief      NT Screen module (header file).
+ *  \details    Contains the NTScreen class definitions: stack of widgets
+ *              drawn with damage tracking and occlusion culling.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSCREEN_H_
+#define _NTSCREEN_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Function wrapper */
+#include <functional>
+/*! \brief  Time durations */
+#include <chrono>
+/*! \brief  Integer limits */
+#include <climits>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  Spatial index */
+#include "ntspatialindex.h"
+/*! \brief  Occlusion map */
+#include "ntocclusion.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+
+#define NTP_BACKGROUND	-1	/*!< Animations and decorations (deferred first) */
+#define NTP_NORMAL		0	/*!< Default priority of a widget */
+#define NTP_CRITICAL	1	/*!< Widgets that must stay current (status, clock) */
+
+class NTLayout;
+class NTTaskPool;
+
+/*! \class      NTScreen
+ *  \brief      Widget compositor.
+ *  \details    Draws a stack of widgets (the last added is on top). Every
+ *              frame only the damaged areas are drawn: the changed area of
+ *              changed widgets and the old and new bounds of moved ones.
+ *              Damaged cells are cleared first, so a widget repaints all of
+ *              its changed area (see NTGraphicObject::dirtyArea()) and all
+ *              of itself when other widgets damaged its cells.
+ *              Widgets that touch the damage are found with the spatial
+ *              index. Opaque widgets (see NTGraphicObject::opaque()) cover
+ *              the cells below them, so hidden cells and rows are skipped and
+ *              fully hidden widgets are not drawn at all. A modal panel over
+ *              a busy dashboard costs as much as the visible area.
+ *
+ *              Every widget has a priority (NTP_NORMAL unless set). A frame
+ *              may draw only the widgets of some priority and above: the
+ *              changes of the others are kept for a later frame, so a busy
+ *              frame drops animations before status labels (see
+ *              NTFrameScheduler).
+ *
+ *              The screen draws into stdscr or into a window of a container
+ *              (see NTPanel); widget coordinates are relative to it. The
+ *              drawn window can be mirrored to other outputs (see attach()).
+ *              The screen does not own the widgets. A widget must be removed
+ *              from the screen before it is destroyed.
+ */
+class NTScreen
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      window  Window to draw into (nullptr - stdscr)
+	 */
+	explicit NTScreen(WINDOW *window = nullptr);
+
+	/*! \brief  Destructor */
+	~NTScreen();
+
+	NTScreen(const NTScreen&) = delete;
+	NTScreen& operator=(const NTScreen&) = delete;
+
+	/*! \brief      Adds a widget on top of the others
+	 *  \param      object  Widget
+	 */
+	void add(NTGraphicObject *object);
+
+	/*! \brief      Removes a widget (its cells are cleared on the next draw)
+	 *  \param      object  Widget
+	 */
+	void remove(NTGraphicObject *object);
+
+	/*! \brief      Sets the priority of a widget
+	 *  \param      object      Widget of the screen
+	 *  \param      priority    Priority (NTP_BACKGROUND, NTP_NORMAL, NTP_CRITICAL or any other)
+	 */
+	void setPriority(NTGraphicObject *object, int priority);
+
+	/*! \brief      Gets the top-most widget that covers the cell
+	 *  \param      x   X coordinate of the cell
+	 *  \param      y   Y coordinate of the cell
+	 *  \return     Widget or nullptr if none
+	 */
+	NTGraphicObject *at(int x, int y) const;
+
+	/*! \brief      Gets the spatial index of the widgets
+	 *  \return     Spatial index
+	 */
+	const NTSpatialIndex &index() const;
+
+	/*! \brief      Sets the window to draw into
+	 *  \details    The whole window is drawn on the next draw().
+	 *  \param      window  Window or pad (nullptr - stdscr)
+	 */
+	void setWindow(WINDOW *window);
+
+	/*! \brief      Sets the task pool whose results are applied before every frame
+	 *  \details    draw() calls NTTaskPool::publish() first, without the mutex
+	 *              held. The pool is not owned.
+	 *  \param      pool    Task pool (nullptr - none)
+	 */
+	void setTaskPool(NTTaskPool *pool);
+
+	/*! \brief  Redraws the whole screen on the next draw() */
+	void invalidate();
+
+	/*! \brief      Attaches an output that mirrors the window
+	 *  \details    A frame that changed the window reads its cells once; every
+	 *              draw() presents them to the attached outputs, from the
+	 *              thread of draw(). An output smaller than the window shows
+	 *              its top left part. Outputs that may be slow (remote
+	 *              viewers) should be stream sinks, which never block the
+	 *              frame. The sink is not owned and must be detached before
+	 *              it is destroyed.
+	 *  \param      sink    Output (the whole window is sent to it first)
+	 */
+	void attach(NTFrameSink *sink);
+
+	/*! \brief      Detaches an output
+	 *  \param      sink    Output
+	 */
+	void detach(NTFrameSink *sink);
+
+	/*! \brief      Gets the area the next draw() will draw
+	 *  \return     Bounding box of the damage (empty if nothing changed)
+	 */
+	nt::Rect pending() const;
+
+	/*! \brief      Gets the area drawn by the last draw()
+	 *  \return     Bounding box of the damage of the last frame
+	 */
+	nt::Rect damaged() const;
+
+	/*! \brief      Sets the function called when the screen size changes
+	 *  \details    Called by draw() before the first frame of a new size
+	 *              (and before the first frame), without the mutex of the
+	 *              screen held, so it may lay the widgets out again.
+	 *  \param      handler Function of the new width and height
+	 */
+	void setResizeHandler(std::function<void(int, int)> handler);
+
+	/*! \brief      Sets the layout of the widgets
+	 *  \details    draw() applies the layout to the whole screen before
+	 *              every frame, without the mutex of the screen held. The
+	 *              layout is cached, so a frame only lays out what changed
+	 *              and a resize lays out the screen again. The screen does
+	 *              not own the layout.
+	 *  \param      layout  Layout (nullptr - none)
+	 */
+	void setLayout(NTLayout *layout);
+
+	/*! \brief      Gets the screen width of the last frame
+	 *  \return     Width in columns
+	 */
+	int width() const;
+
+	/*! \brief      Gets the screen height of the last frame
+	 *  \return     Height in rows
+	 */
+	int height() const;
+
+	/*! \brief      Gets the number of widgets skipped as hidden in the last frame
+	 *  \return     Number of widgets
+	 */
+	size_t culled() const;
+
+	/*! \brief      Gets the number of widgets deferred by the last frame
+	 *  \return     Changed widgets below the priority of the frame
+	 */
+	size_t deferred() const;
+
+	/*! \brief      Gets the time the last draw() spent drawing the widgets
+	 *  \return     Time from the start of the frame to the output
+	 */
+	std::chrono::microseconds rasterTime() const;
+
+	/*! \brief      Gets the time the last draw() spent writing to the terminal
+	 *  \details    Grows when the terminal reads slowly (a slow link).
+	 *  \return     Time of refresh() (zero when drawing into a window)
+	 */
+	std::chrono::microseconds outputTime() const;
+
+	/*! \brief     Draws the damaged areas
+	 *  \details   A screen drawn into stdscr applies a pending terminal
+	 *             resize first (see NTTerminal). A new size is drawn as one
+	 *             full frame after the widgets are notified. Changed widgets
+	 *             below the priority keep their changes for a later frame;
+	 *             they are still drawn where the damage of others touches them.
+	 *  \param     priority    Lowest priority of the widgets to draw
+	 *  \return    OK if success,
+	 *            ERR if a widget failed to draw
+	 */
+	int draw(int priority = INT_MIN);
+
+private:
+	/*!	\brief	Widget on the screen */
+	struct Item {
+		NTGraphicObject *object;	/*!< Widget */
+		nt::Rect drawn;				/*!< Bounds of the widget on the screen */
+		bool shown;					/*!< Widget was drawn at least once */
+		int priority;				/*!< Priority of the widget */
+	};
+
+	/*!	\brief	Damaged area */
+	struct Damage {
+		nt::Rect rect;				/*!< Screen area */
+		NTGraphicObject *source;	/*!< Changed widget that redraws the area itself (nullptr - none) */
+	};
+
+	/*!	\brief	Widget drawn in the current frame */
+	struct Layer {
+		size_t item;				/*!< Index of the item (depth) */
+		nt::Rect rect;				/*!< Bounds of the widget */
+	};
+
+	/*! \brief      Notifies the handler and the widgets of a new size
+	 *  \details    Must be called without _mutex held.
+	 */
+	void resize();
+
+	/*! \brief      Collects the damage of the next frame
+	 *  \details    Must be called with _mutex held.
+	 *  \param      damage      Changed areas, old and new bounds of moved widgets
+	 *  \param      priority    Lowest priority of the widgets to draw
+	 *  \param      deferred    Flag of every item deferred by the priority (nullptr - not needed)
+	 */
+	void collect(std::vector<Damage> &damage, int priority, std::vector<char> *deferred) const;
+
+	mutable std::mutex _mutex;			/*!< Guards the widget stack */
+	WINDOW *_window;					/*!< Window to draw into (nullptr - stdscr) */
+	std::vector<Item> _items;			/*!< Widgets from the bottom to the top */
+	std::vector<Damage> _damage;		/*!< Areas damaged by removed widgets */
+	std::vector<NTFrameSink *> _sinks;	/*!< Outputs that mirror the window */
+	NTFrameBuffer _mirror;				/*!< Cells of the window for the outputs */
+	bool _mirrored;						/*!< Cells of the window were read after the last change */
+	NTSpatialIndex _index;				/*!< Bounds of the widgets */
+	NTOcclusion _occlusion;				/*!< Occlusion map of the frame */
+	std::function<void(int, int)> _onResize;	/*!< Resize handler */
+	NTLayout *_layout;					/*!< Layout of the widgets (nullptr - none) */
+	NTTaskPool *_pool;					/*!< Task pool of the widgets (nullptr - none) */
+	bool _full;							/*!< Whole screen needs drawing */
+	int _width;							/*!< Screen width of the last frame */
+	int _height;						/*!< Screen height of the last frame */
+	size_t _culled;						/*!< Widgets skipped in the last frame */
+	size_t _deferred;					/*!< Widgets deferred by the last frame */
+	std::chrono::microseconds _raster;	/*!< Drawing time of the last frame */
+	std::chrono::microseconds _output;	/*!< Output time of the last frame */
+	nt::Rect _damaged;					/*!< Damage of the last frame */
+};
+
+#endif // _NTSCREEN_H_
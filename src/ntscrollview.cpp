@@ -0,0 +1,366 @@
+/*!	\file		ntscrollview.cpp
+ *	\brief		Implementation of thread-safe NTScrollView class
+ *	\details	Contains method implementations for virtualized scroll views in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntscrollview.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Numeric limits */
+#include <climits>
+
+// Default constructor
+NTScrollView::NTScrollView(NTObject *parent, const std::string &name)
+	: NTScrollView(parent, name, 0, 0, 0, 0)
+{
+}
+
+// Parameterized constructor
+NTScrollView::NTScrollView(NTObject *parent, const std::string &name, int x, int y,
+						   unsigned int width, unsigned int height)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the viewport
+	0,								// Color pair (children have their own)
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_width(width), _height(height),
+	_scroll(0), _tallest(0), _contentHeight(0), _screenHeight(INT_MAX),
+	_drawn(false), _drawnArea({0, 0, 0, 0}), _drawnScroll(0)
+{
+}
+
+// Destructor
+NTScrollView::~NTScrollView() = default;
+
+// Adds a child or moves it in the content
+void NTScrollView::add(NTGraphicObject *child, int x, int y)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_members.insert(child).second) {
+		_children.erase(std::remove_if(_children.begin(), _children.end(),
+			[child](const Child &c) { return c.object == child; }), _children.end());
+	}
+
+	// Children are usually added top to bottom, so this is an append
+	auto it = std::upper_bound(_children.begin(), _children.end(), y,
+		[](int row, const Child &c) { return row < c.y; });
+	_children.insert(it, {child, x, y});
+
+	nt::Rect bounds = child->bounds();
+	_tallest = std::max(_tallest, bounds.height);
+	_contentHeight = std::max<unsigned int>(_contentHeight, std::max(y + bounds.height, 0));
+
+	_shown.clear();
+	_drawn = false;
+	_changed = true;
+}
+
+// Removes a child
+void NTScrollView::remove(NTGraphicObject *child)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_members.erase(child)) return;
+	_children.erase(std::remove_if(_children.begin(), _children.end(),
+		[child](const Child &c) { return c.object == child; }), _children.end());
+	measureContent();
+
+	_shown.clear();
+	_drawn = false;
+	_changed = true;
+}
+
+// Gets the number of children
+size_t NTScrollView::count() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _children.size();
+}
+
+// Sets the viewport size
+void NTScrollView::setSize(unsigned int width, unsigned int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_width = width;
+	_height = height;
+	_changed = true;
+	placed();
+}
+
+// Moves and resizes the viewport to an area of a layout
+bool NTScrollView::setGeometry(const nt::Rect &rect)
+{
+	setPosition(rect.x, rect.y);
+	nt::Rect current = bounds();
+	if (current.width != rect.width || current.height != rect.height) {
+		setSize(static_cast<unsigned int>(std::max(rect.width, 0)),
+				static_cast<unsigned int>(std::max(rect.height, 0)));
+	}
+	return true;
+}
+
+// Gets the viewport width
+unsigned int NTScrollView::width() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _width;
+}
+
+// Gets the viewport height
+unsigned int NTScrollView::height() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _height;
+}
+
+// Gets the content height
+unsigned int NTScrollView::contentHeight() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _contentHeight;
+}
+
+// Sets the first visible content row
+void NTScrollView::setOffset(int offset)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	offset = std::clamp(offset, 0, lastOffset());
+	if (offset == _scroll) return;
+	_scroll = offset;
+	_changed = true;
+}
+
+// Scrolls the view
+void NTScrollView::scrollBy(int rows)
+{
+	setOffset(offset() + rows);
+}
+
+// Gets the first visible content row
+int NTScrollView::offset() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _scroll;
+}
+
+// Forces a full redraw on the next draw()
+void NTScrollView::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_drawn = false;
+	_changed = true;
+}
+
+// Keeps the last content row reachable on the new screen
+void NTScrollView::screenResized(int width, int height)
+{
+	std::vector<NTGraphicObject *> children;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_screenHeight = height;
+		int offset = std::clamp(_scroll, 0, lastOffset());
+		if (offset != _scroll) {
+			_scroll = offset;
+			_changed = true;
+		}
+		for (const Child &child : _children) children.push_back(child.object);
+	}
+
+	for (NTGraphicObject *child : children) child->screenResized(width, height);
+}
+
+// Gets the area covered by the viewport
+nt::Rect NTScrollView::area() const
+{
+	return {_x, _y, static_cast<int>(_width), static_cast<int>(_height)};
+}
+
+// Gets the area changed since the last draw
+nt::Rect NTScrollView::dirtyArea() const
+{
+	nt::Rect view = area();
+	if (!_drawn || _scroll != _drawnScroll || view != _drawnArea) return view;
+
+	int x0 = INT_MAX, y0 = INT_MAX, x1 = INT_MIN, y1 = INT_MIN;
+	for (const Child *child : _shown) {
+		if (!child->object->isChanged()) continue;
+		nt::Rect rect = nt::intersect(child->object->bounds(), view);
+		if (rect.width == 0 || rect.height == 0) continue;
+		x0 = std::min(x0, rect.x);
+		y0 = std::min(y0, rect.y);
+		x1 = std::max(x1, rect.x + rect.width);
+		y1 = std::max(y1, rect.y + rect.height);
+	}
+	if (x0 > x1) return {_x, _y, 0, 0};
+	return {x0, y0, x1 - x0, y1 - y0};
+}
+
+// Checks if the view or a visible child needs drawing
+bool NTScrollView::dirty() const
+{
+	if (_changed) return true;
+	for (const Child *child : _shown) {
+		if (child->object->isChanged()) return true;
+	}
+	return false;
+}
+
+// Viewport is cleared before the children are drawn
+bool NTScrollView::opaque() const
+{
+	return true;
+}
+
+// Finds the children that intersect the viewport
+void NTScrollView::visibleChildren(std::vector<const Child *> &result) const
+{
+	result.clear();
+	int top = _scroll;
+	int bottom = _scroll + static_cast<int>(_height);
+
+	// Children starting above the viewport are at most _tallest rows high
+	auto it = std::lower_bound(_children.begin(), _children.end(), top - _tallest + 1,
+		[](const Child &c, int row) { return c.y < row; });
+	for (; it != _children.end() && it->y < bottom; ++it) {
+		nt::Rect bounds = it->object->bounds();
+		if (it->y + bounds.height > top && it->x < static_cast<int>(_width) && it->x + bounds.width > 0) {
+			result.push_back(&*it);
+		}
+	}
+}
+
+// Updates the content height
+void NTScrollView::measureContent()
+{
+	_tallest = 0;
+	_contentHeight = 0;
+	for (const Child &child : _children) {
+		nt::Rect bounds = child.object->bounds();
+		_tallest = std::max(_tallest, bounds.height);
+		_contentHeight = std::max<unsigned int>(_contentHeight, std::max(child.y + bounds.height, 0));
+	}
+}
+
+// Gets the largest offset
+int NTScrollView::lastOffset() const
+{
+	// Rows below the bottom of the screen can not show the end of the content
+	int rows = static_cast<int>(_height);
+	if (_screenHeight != INT_MAX && _screenHeight - _y > 0) rows = std::min(rows, _screenHeight - _y);
+	return std::max(static_cast<int>(_contentHeight) - rows, 0);
+}
+
+// Draws the viewport
+int NTScrollView::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + static_cast<int>(_height) <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + static_cast<int>(_width) <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	nt::Rect view = area();
+	bool full = !_drawn || view != _drawnArea;
+	_clip.reset(max_x, max_y);
+
+	// Small scroll: shift what is on the screen and draw the exposed rows
+	int rows = _scroll - _drawnScroll;
+	if (!full && rows != 0) {
+		if (std::abs(rows) < view.height && shiftArea(view, rows)) {
+			_clip.damage(rows > 0 ? nt::Rect{view.x, view.y + view.height - rows, view.width, rows}
+								  : nt::Rect{view.x, view.y, view.width, -rows});
+		} else {
+			full = true;
+		}
+	}
+
+	// Damage of the changed children (other children under it are redrawn too)
+	std::vector<std::pair<nt::Rect, NTGraphicObject *>> damage;
+	if (full) {
+		_clip.damage(view);
+	} else if (_occlusion) {
+		// A screen cleared all of dirtyArea(): the children under it are redrawn too
+		nt::Rect rect = dirtyArea();
+		_clip.damage(rect);
+		damage.push_back({rect, nullptr});
+	} else {
+		for (const Child *child : _shown) {
+			if (!child->object->isChanged()) continue;
+			nt::Rect rect = nt::intersect(child->object->bounds(), view);
+			_clip.damage(rect);
+			damage.push_back({rect, child->object});
+		}
+	}
+
+	// Drawn inside a screen: only where the screen allows
+	if (_occlusion) _clip.restrict(*_occlusion, _depth);
+
+	// Clear the damaged cells of the viewport
+	nt::Rect visible = nt::intersect(view, {0, 0, max_x, max_y});
+	for (int y = visible.y; y < visible.y + visible.height; y++) {
+		for (int x = visible.x; x < visible.x + visible.width; x++) {
+			if (_clip.bare(x, y)) clearCell(y, x);
+		}
+	}
+
+	// Draw the children that intersect the viewport, clipped to it. Both lists
+	// are in the order of _children, so the old one is sorted by address
+	std::vector<const Child *> previous;
+	previous.swap(_shown);
+	visibleChildren(_shown);
+	bool moved = full || rows != 0;
+	for (const Child *child : _shown) {
+		NTGraphicObject *object = child->object;
+		if (moved || !std::binary_search(previous.begin(), previous.end(), child)) {
+			object->setPosition(view.x + child->x, view.y + child->y - _scroll);
+			object->invalidate();
+		} else {
+			nt::Rect bounds = object->bounds();
+			bool covered = false;
+			for (const auto &area : damage) {
+				if (area.second != object && nt::overlaps(area.first, bounds)) {
+					covered = true;
+					break;
+				}
+			}
+			if (covered) {
+				object->invalidate();
+			} else if (!object->isChanged()) {
+				continue;
+			}
+		}
+		if (drawClipped(object, &_clip, 0, _window, _layer) == ERR) result = ERR;
+	}
+
+	// Remember what is on the screen
+	_drawn = true;
+	_drawnArea = view;
+	_drawnScroll = _scroll;
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
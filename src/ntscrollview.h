@@ -0,0 +1,218 @@
+/*! \file       ntscrollview.h
+ *  \brief      NT Scroll view module (header file).
+ *  \details    Contains the NTScrollView class definitions: container that
+ *              shows a vertically scrolled window of its children.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSCROLLVIEW_H_
+#define _NTSCROLLVIEW_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Standard hash set */
+#include <unordered_set>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  Occlusion map */
+#include "ntocclusion.h"
+
+/*! \class      NTScrollView
+ *  \brief      Virtualized scroll view.
+ *  \details    Children are placed at content coordinates and kept sorted by
+ *              row, so draw() finds the children that intersect the viewport
+ *              with a binary search and never touches the others: scrolling
+ *              a view of 100k lines costs as much as one of 50 lines. The
+ *              view moves the visible children to their screen position
+ *              before drawing them and clips them to the viewport.
+ *
+ *              When the view scrolled by less than its height and is drawn
+ *              on its own (not by a screen or into a frame buffer), the
+ *              content on the screen is shifted with wscrl() on a subwindow
+ *              (ncurses turns it into a terminal scroll region where the
+ *              terminal supports it) and only the exposed rows are drawn.
+ *
+ *              The view does not own the children. Positions of the children
+ *              are managed by the view; change them with add().
+ *  \extends    NTGraphicObject
+ */
+class NTScrollView : public NTGraphicObject
+{
+public:
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    View name (default: empty string)
+	 */
+	NTScrollView(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent  Pointer to the parent object
+	 *  \param      name    View name
+	 *  \param      x       X coordinate of the viewport
+	 *  \param      y       Y coordinate of the viewport
+	 *  \param      width   Viewport width
+	 *  \param      height  Viewport height
+	 */
+	NTScrollView(NTObject *parent, const std::string &name, int x, int y,
+				 unsigned int width, unsigned int height);
+
+	/*! \brief  Destructor */
+	~NTScrollView();
+
+	NTScrollView(const NTScrollView&) = delete;
+	NTScrollView& operator=(const NTScrollView&) = delete;
+
+	/*! \brief      Adds a child or moves it in the content
+	 *  \param      child   Child widget
+	 *  \param      x       X coordinate in the content
+	 *  \param      y       Y coordinate (row) in the content
+	 */
+	void add(NTGraphicObject *child, int x, int y);
+
+	/*! \brief      Removes a child
+	 *  \param      child   Child widget
+	 */
+	void remove(NTGraphicObject *child);
+
+	/*! \brief      Gets the number of children
+	 *  \return     Number of children
+	 */
+	size_t count() const;
+
+	/*! \brief      Sets the viewport size
+	 *  \param      width   Viewport width
+	 *  \param      height  Viewport height
+	 */
+	void setSize(unsigned int width, unsigned int height);
+
+	/*! \brief      Moves and resizes the viewport to an area of a layout
+	 *  \param      rect    Assigned area
+	 *  \return     true
+	 */
+	bool setGeometry(const nt::Rect &rect) override;
+
+	/*! \brief      Gets the viewport width
+	 *  \return     Width in columns
+	 */
+	unsigned int width() const;
+
+	/*! \brief      Gets the viewport height
+	 *  \return     Height in rows
+	 */
+	unsigned int height() const;
+
+	/*! \brief      Gets the content height
+	 *  \return     Rows from the first row to the bottom of the lowest child
+	 */
+	unsigned int contentHeight() const;
+
+	/*! \brief      Sets the first visible content row
+	 *  \param      offset  Row (clamped to the content)
+	 */
+	void setOffset(int offset);
+
+	/*! \brief      Scrolls the view
+	 *  \param      rows    Rows to scroll down (negative - up)
+	 */
+	void scrollBy(int rows);
+
+	/*! \brief      Gets the first visible content row
+	 *  \return     Row
+	 */
+	int offset() const;
+
+	/*! \brief      Forces a full redraw on the next draw() */
+	void invalidate() override;
+
+	/*! \brief      Keeps the last content row reachable on the new screen
+	 *  \details    Clamps the offset to the rows of the viewport left on the
+	 *              screen and notifies the children (they are drawn in screen
+	 *              coordinates, so the screen of the view is theirs too).
+	 *  \param      width   Screen width
+	 *  \param      height  Screen height
+	 */
+	void screenResized(int width, int height) override;
+
+	/*! \brief     Draws the viewport
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the viewport
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Gets the area changed since the last draw
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Viewport if scrolled, otherwise the changed visible children
+	 */
+	nt::Rect dirtyArea() const override;
+
+	/*! \brief      Checks if the view or a visible child needs drawing
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if changed, false otherwise
+	 */
+	bool dirty() const override;
+
+	/*! \brief      Viewport is cleared before the children are drawn
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true
+	 */
+	bool opaque() const override;
+
+private:
+	/*!	\brief	Child in the content */
+	struct Child {
+		NTGraphicObject *object;	/*!< Child widget */
+		int x;						/*!< X coordinate in the content */
+		int y;						/*!< Row in the content */
+	};
+
+	/*! \brief      Finds the children that intersect the viewport
+	 *  \details    Must be called with _mutex held.
+	 *  \param      result  Children in drawing order (cleared first)
+	 */
+	void visibleChildren(std::vector<const Child *> &result) const;
+
+	/*! \brief      Updates the content height
+	 *  \details    Must be called with _mutex held.
+	 */
+	void measureContent();
+
+	/*! \brief      Gets the largest offset
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Offset that shows the last content row at the bottom of
+	 *              the part of the viewport on the screen
+	 */
+	int lastOffset() const;
+
+	std::vector<Child> _children;		/*!< Children sorted by row */
+	std::unordered_set<NTGraphicObject *> _members;	/*!< Children for the membership check */
+	std::vector<const Child *> _shown;	/*!< Children drawn in the last frame */
+	unsigned int _width;				/*!< Viewport width */
+	unsigned int _height;				/*!< Viewport height */
+	int _scroll;						/*!< First visible content row */
+	int _tallest;						/*!< Height of the tallest child */
+	unsigned int _contentHeight;		/*!< Content height */
+	int _screenHeight;					/*!< Screen height (INT_MAX - not known yet) */
+	NTOcclusion _clip;					/*!< Clip map of the children */
+
+	bool _drawn;						/*!< Viewport is on the screen */
+	nt::Rect _drawnArea;				/*!< Viewport on the screen */
+	int _drawnScroll;					/*!< Scroll of the viewport on the screen */
+};
+
+#endif // _NTSCROLLVIEW_H_
@@ -0,0 +1,347 @@
+/*!	\file		ntsparkline.cpp
+ *	\brief		Implementation of thread-safe NTSparkline class
+ *	\details	Contains method implementations for time-series graphs in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntsparkline.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  Math functions */
+#include <cmath>
+
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+namespace {
+	const char32_t BLOCK_BASE = 0x2580;		// U+2581..U+2588 are 1/8..8/8 blocks
+	const char32_t BRAILLE_BASE = 0x2800;	// U+2800 + dot bits
+
+	// Braille dot bits from the top row to the bottom one
+	const unsigned char BRAILLE_LEFT[4] = {0x01, 0x02, 0x04, 0x40};
+	const unsigned char BRAILLE_RIGHT[4] = {0x08, 0x10, 0x20, 0x80};
+}
+
+// Default constructor
+NTSparkline::NTSparkline(NTObject *parent, const std::string &name)
+	: NTSparkline(parent, name, 0, 0, 0, 1)
+{
+}
+
+// Parameterized constructor
+NTSparkline::NTSparkline(NTObject *parent, const std::string &name, int x, int y,
+						 unsigned int width, unsigned int height, size_t capacity)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate
+	0,								// Color pair
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_capacity(nt::powerOfTwo(std::max<size_t>(capacity, 1))),
+	_write(0), _read(0), _dropped(0),
+	_width(width), _height(height), _mode(Blocks), _perBucket(1),
+	_newest(0), _used(0), _autoRange(true), _min(0.0f), _max(1.0f), _drawnX(x), _drawnY(y)
+{
+	_samples = std::make_unique<float[]>(_capacity);
+	reshape();
+}
+
+// Destructor
+NTSparkline::~NTSparkline() = default;
+
+// Pushes a sample
+bool NTSparkline::push(float sample)
+{
+	size_t write = _write.load(std::memory_order_relaxed);
+	if (write - _read.load(std::memory_order_acquire) >= _capacity) {
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	_samples[write & (_capacity - 1)] = sample;
+	_write.store(write + 1, std::memory_order_release);
+	return true;
+}
+
+// Gets the number of dropped samples
+uint64_t NTSparkline::dropped() const
+{
+	return _dropped.load(std::memory_order_relaxed);
+}
+
+// Sets the number of samples per bucket
+void NTSparkline::setSamplesPerBucket(unsigned int samples)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_perBucket = std::max(samples, 1u);
+	reshape();
+	_changed = true;
+}
+
+// Gets the number of samples per bucket
+unsigned int NTSparkline::samplesPerBucket() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _perBucket;
+}
+
+// Sets the glyph set
+void NTSparkline::setMode(Mode mode)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (mode == _mode) return;
+	_mode = mode;
+	reshape();
+	_changed = true;
+}
+
+// Gets the glyph set
+NTSparkline::Mode NTSparkline::mode() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _mode;
+}
+
+// Sets the graph size
+void NTSparkline::setSize(unsigned int width, unsigned int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_width = width;
+	_height = height;
+	reshape();
+	_changed = true;
+	placed();
+}
+
+// Moves and resizes the graph to an area of a layout
+bool NTSparkline::setGeometry(const nt::Rect &rect)
+{
+	setPosition(rect.x, rect.y);
+	nt::Rect current = bounds();
+	if (current.width != rect.width || current.height != rect.height) {
+		setSize(static_cast<unsigned int>(std::max(rect.width, 0)),
+				static_cast<unsigned int>(std::max(rect.height, 0)));
+	}
+	return true;
+}
+
+// Sets a fixed value range
+void NTSparkline::setRange(float min, float max)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_autoRange = false;
+	_min = min;
+	_max = max;
+	_changed = true;
+}
+
+// Scales the graph to the values of the history
+void NTSparkline::setAutoRange()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_autoRange = true;
+	_changed = true;
+}
+
+// Removes the history (queued samples are kept)
+void NTSparkline::clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::fill(_history.begin(), _history.end(), Bucket{0.0f, 0.0f, 0.0f, 0});
+	_newest = 0;
+	_used = 0;
+	_changed = true;
+}
+
+// Forces a full redraw on the next draw()
+void NTSparkline::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::fill(_cells.begin(), _cells.end(), 0);
+	_changed = true;
+}
+
+// Gets the area covered by the graph
+nt::Rect NTSparkline::area() const
+{
+	return {_x, _y, static_cast<int>(_width), static_cast<int>(_height)};
+}
+
+// Checks if samples are queued or the graph changed
+bool NTSparkline::dirty() const
+{
+	return _changed || _write.load(std::memory_order_relaxed) != _read.load(std::memory_order_relaxed);
+}
+
+// Every cell is drawn, so the graph hides what is below it
+bool NTSparkline::opaque() const
+{
+	return !(_ntattr & NTA_SPACE_TRANSPARENT);
+}
+
+// Rebuilds the history for the current size and mode
+void NTSparkline::reshape()
+{
+	size_t buckets = _mode == Braille ? 2 * static_cast<size_t>(_width) : _width;
+	_history.assign(buckets, Bucket{0.0f, 0.0f, 0.0f, 0});
+	_newest = 0;
+	_used = 0;
+	_cells.assign(static_cast<size_t>(_width) * _height, 0);
+}
+
+// Moves the queued samples into the history
+bool NTSparkline::drain()
+{
+	size_t write = _write.load(std::memory_order_acquire);
+	size_t read = _read.load(std::memory_order_relaxed);
+	if (read == write) return false;
+
+	unsigned int buckets = static_cast<unsigned int>(_history.size());
+	for (; buckets > 0 && read != write; read++) {
+		float sample = _samples[read & (_capacity - 1)];
+		if (std::isnan(sample)) continue;
+
+		// Full bucket: start the next one over the oldest
+		Bucket *bucket = &_history[_newest];
+		if (_used == 0) {
+			_used = 1;
+		} else if (bucket->count >= _perBucket) {
+			_newest = (_newest + 1) % buckets;
+			_used = std::min(_used + 1, buckets);
+			bucket = &_history[_newest];
+			bucket->count = 0;
+		}
+
+		if (bucket->count == 0) {
+			*bucket = Bucket{sample, sample, sample, 1};
+		} else {
+			bucket->min = std::min(bucket->min, sample);
+			bucket->max = std::max(bucket->max, sample);
+			bucket->sum += sample;
+			bucket->count++;
+		}
+	}
+
+	_read.store(write, std::memory_order_release);
+	return true;
+}
+
+// Gets a bucket by age
+const NTSparkline::Bucket *NTSparkline::bucket(unsigned int age) const
+{
+	if (age >= _used) return nullptr;
+	unsigned int buckets = static_cast<unsigned int>(_history.size());
+	return &_history[(_newest + buckets - age) % buckets];
+}
+
+// Gets the glyph of a cell
+char32_t NTSparkline::glyph(unsigned int column, unsigned int row, float low, float scale) const
+{
+	int bottom = static_cast<int>(_height - 1 - row);	// cell row from the bottom
+	unsigned int age = _width - 1 - column;				// newest bucket on the right
+
+	if (_mode == Blocks) {
+		const Bucket *b = bucket(age);
+		if (!b) return ' ';
+		int steps = static_cast<int>(_height) * 8;
+		int level = static_cast<int>(std::lround((b->sum / b->count - low) * scale));
+		level = std::clamp(level, 1, steps);	// a sample is never invisible
+		int eighths = std::clamp(level - bottom * 8, 0, 8);
+		return eighths ? BLOCK_BASE + eighths : ' ';
+	}
+
+	// Braille: older bucket in the left dot column, dots from min to max
+	int dots = static_cast<int>(_height) * 4;
+	unsigned char bits = 0;
+	for (int half = 0; half < 2; half++) {
+		const Bucket *b = bucket(2 * age + 1 - half);
+		if (!b) continue;
+		int lo = std::clamp(static_cast<int>(std::floor((b->min - low) * scale)), 0, dots - 1);
+		int hi = std::clamp(static_cast<int>(std::floor((b->max - low) * scale)), 0, dots - 1);
+		for (int level = std::max(lo, bottom * 4); level <= std::min(hi, bottom * 4 + 3); level++) {
+			int dot = 3 - (level - bottom * 4);
+			bits |= half == 0 ? BRAILLE_LEFT[dot] : BRAILLE_RIGHT[dot];
+		}
+	}
+	return bits ? BRAILLE_BASE + bits : ' ';
+}
+
+// Draws the graph
+int NTSparkline::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + static_cast<int>(_height) <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + static_cast<int>(_width) <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	drain();
+
+	// Moved graph: the glyphs on the screen are not where _cells says. Neither
+	// are they under a screen, which cleared the whole graph (dirtyArea())
+	if (_occlusion || _x != _drawnX || _y != _drawnY) {
+		std::fill(_cells.begin(), _cells.end(), 0);
+		_drawnX = _x;
+		_drawnY = _y;
+	}
+
+	// Value range: fixed or the range of the buckets with samples
+	float low = _min, high = _max;
+	if (_autoRange && _used > 0) {
+		low = bucket(0)->min;
+		high = bucket(0)->max;
+		for (unsigned int age = 1; age < _used; age++) {
+			low = std::min(low, bucket(age)->min);
+			high = std::max(high, bucket(age)->max);
+		}
+	}
+	if (!(high - low > 1e-6f)) high = low + 1.0f;
+	int steps = _mode == Blocks ? static_cast<int>(_height) * 8 : static_cast<int>(_height) * 4 - 1;
+	float scale = static_cast<float>(steps) / (high - low);
+
+	// Write only the cells whose glyph changed
+	for (unsigned int row = 0; row < _height; row++) {
+		int y = _y + static_cast<int>(row);
+		for (unsigned int column = 0; column < _width; column++) {
+			int x = _x + static_cast<int>(column);
+			char32_t &cell = _cells[static_cast<size_t>(row) * _width + column];
+			if (y < 0 || y >= max_y || x < 0 || x >= max_x) {
+				cell = 0;
+				continue;
+			}
+
+			char32_t cp = glyph(column, row, low, scale);
+			if (cp == cell) continue;
+
+			char bytes[4];
+			size_t length = nt::encode(cp, bytes);
+			if (drawGlyph(y, x, bytes, length) == ERR) result = ERR;
+			cell = cp;
+		}
+	}
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
@@ -0,0 +1,224 @@
+/*! \file       ntsparkline.h
+ *  \brief      NT Sparkline module (header file).
+ *  \details    Contains the NTSparkline class definitions: time-series graph
+ *              fed through a lock-free single-producer ring of samples.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSPARKLINE_H_
+#define _NTSPARKLINE_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Standard smart pointers */
+#include <memory>
+/*! \brief  Atomic operations */
+#include <atomic>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+
+/*! \class      NTSparkline
+ *  \brief      Sparkline / time-series graph widget.
+ *  \details    One thread pushes samples into a lock-free ring (push() is
+ *              O(1) and never blocks; samples are dropped when the ring is
+ *              full). draw() drains the ring and folds every sample into the
+ *              bucket of the newest graph column (min, max, sum, count), so
+ *              the history is downsampled incrementally and never recomputed.
+ *              A redraw is O(width * height) and only the cells whose glyph
+ *              changed are written to the terminal.
+ *
+ *              Blocks mode draws the average of each bucket with the
+ *              ▁▂▃▄▅▆▇█ glyphs, one bucket per column. Braille mode draws the
+ *              min..max range of each bucket with braille dots, two buckets
+ *              per column and four dots per row.
+ *  \extends    NTGraphicObject
+ */
+class NTSparkline : public NTGraphicObject
+{
+public:
+	/*!	\brief	Glyph set of the graph */
+	enum Mode {
+		Blocks,		/*!< Block elements, average of a bucket */
+		Braille		/*!< Braille dots, min..max range of a bucket */
+	};
+
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    Graph name (default: empty string)
+	 */
+	NTSparkline(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent      Pointer to the parent object
+	 *  \param      name        Graph name
+	 *  \param      x           X coordinate
+	 *  \param      y           Y coordinate
+	 *  \param      width       Width in columns
+	 *  \param      height      Height in rows
+	 *  \param      capacity    Samples the ring holds between two frames
+	 *                          (rounded up to a power of two)
+	 */
+	NTSparkline(NTObject *parent, const std::string &name, int x, int y,
+				unsigned int width, unsigned int height = 1, size_t capacity = 4096);
+
+	/*! \brief  Destructor */
+	~NTSparkline();
+
+	NTSparkline(const NTSparkline&) = delete;
+	NTSparkline& operator=(const NTSparkline&) = delete;
+
+	/*! \brief      Pushes a sample
+	 *  \details    Lock-free. Must be called from one producer thread only.
+	 *  \param      sample  Value
+	 *  \return     true if queued, false if the ring is full (sample dropped)
+	 */
+	bool push(float sample);
+
+	/*! \brief      Gets the number of dropped samples
+	 *  \return     Number of samples
+	 */
+	uint64_t dropped() const;
+
+	/*! \brief      Sets the number of samples per bucket
+	 *  \details    Clears the history.
+	 *  \param      samples     Samples per bucket (at least 1)
+	 */
+	void setSamplesPerBucket(unsigned int samples);
+
+	/*! \brief      Gets the number of samples per bucket
+	 *  \return     Samples per bucket
+	 */
+	unsigned int samplesPerBucket() const;
+
+	/*! \brief      Sets the glyph set
+	 *  \details    Clears the history.
+	 *  \param      mode    Glyph set
+	 */
+	void setMode(Mode mode);
+
+	/*! \brief      Gets the glyph set
+	 *  \return     Glyph set
+	 */
+	Mode mode() const;
+
+	/*! \brief      Sets the graph size
+	 *  \details    Clears the history.
+	 *  \param      width   Width in columns
+	 *  \param      height  Height in rows
+	 */
+	void setSize(unsigned int width, unsigned int height);
+
+	/*! \brief      Moves and resizes the graph to an area of a layout
+	 *  \param      rect    Assigned area
+	 *  \return     true
+	 */
+	bool setGeometry(const nt::Rect &rect) override;
+
+	/*! \brief      Sets a fixed value range
+	 *  \param      min     Value at the bottom
+	 *  \param      max     Value at the top
+	 */
+	void setRange(float min, float max);
+
+	/*! \brief  Scales the graph to the values of the history */
+	void setAutoRange();
+
+	/*! \brief  Removes the history (queued samples are kept) */
+	void clear();
+
+	/*! \brief      Forces a full redraw on the next draw() */
+	void invalidate() override;
+
+	/*! \brief     Draws the graph
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the graph
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Checks if samples are queued or the graph changed
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if changed, false otherwise
+	 */
+	bool dirty() const override;
+
+	/*! \brief      Every cell is drawn, so the graph hides what is below it
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true unless spaces are transparent
+	 */
+	bool opaque() const override;
+
+private:
+	/*!	\brief	Downsampled samples of one graph bucket */
+	struct Bucket {
+		float min;				/*!< Smallest sample */
+		float max;				/*!< Largest sample */
+		float sum;				/*!< Sum of the samples */
+		unsigned int count;		/*!< Number of samples */
+	};
+
+	/*! \brief      Rebuilds the history for the current size and mode
+	 *  \details    Must be called with _mutex held.
+	 */
+	void reshape();
+
+	/*! \brief      Moves the queued samples into the history
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true if any sample was added
+	 */
+	bool drain();
+
+	/*! \brief      Gets a bucket by age
+	 *  \details    Must be called with _mutex held.
+	 *  \param      age     0 - newest bucket
+	 *  \return     Bucket or nullptr if it has no samples yet
+	 */
+	const Bucket *bucket(unsigned int age) const;
+
+	/*! \brief      Gets the glyph of a cell
+	 *  \details    Must be called with _mutex held.
+	 *  \param      column  Graph column
+	 *  \param      row     Graph row (0 - top)
+	 *  \param      low     Value at the bottom
+	 *  \param      scale   Steps of the graph per value unit
+	 *  \return     Code point
+	 */
+	char32_t glyph(unsigned int column, unsigned int row, float low, float scale) const;
+
+	std::unique_ptr<float[]> _samples;		/*!< Ring of queued samples */
+	size_t _capacity;						/*!< Ring size (power of two) */
+	std::atomic<size_t> _write;				/*!< Samples pushed (producer) */
+	std::atomic<size_t> _read;				/*!< Samples drained (consumer) */
+	std::atomic<uint64_t> _dropped;			/*!< Samples dropped on a full ring */
+
+	unsigned int _width;					/*!< Width in columns */
+	unsigned int _height;					/*!< Height in rows */
+	Mode _mode;								/*!< Glyph set */
+	unsigned int _perBucket;				/*!< Samples per bucket */
+	std::vector<Bucket> _history;			/*!< Ring of buckets */
+	unsigned int _newest;					/*!< Index of the bucket being filled */
+	unsigned int _used;						/*!< Buckets with samples */
+	bool _autoRange;						/*!< Range follows the history */
+	float _min;								/*!< Fixed value at the bottom */
+	float _max;								/*!< Fixed value at the top */
+	std::vector<char32_t> _cells;			/*!< Glyphs on the screen (0 - not drawn) */
+	int _drawnX;							/*!< X coordinate of the glyphs on the screen */
+	int _drawnY;							/*!< Y coordinate of the glyphs on the screen */
+};
+
+#endif // _NTSPARKLINE_H_
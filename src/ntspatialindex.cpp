@@ -0,0 +1,199 @@
+/*!	\file		ntspatialindex.cpp
+ *	\brief		Implementation of the NTSpatialIndex class
+ *	\details	Contains method implementations for the widget spatial index in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntspatialindex.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+namespace {
+	// Divides rounding towards negative infinity
+	int floorDiv(int a, int b)
+	{
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+}
+
+// Constructor
+NTSpatialIndex::NTSpatialIndex(int bucketWidth, int bucketHeight)
+	: _bucketWidth(std::max(bucketWidth, 1)), _bucketHeight(std::max(bucketHeight, 1)),
+	_order(0), _stamp(0)
+{
+}
+
+// Destructor
+NTSpatialIndex::~NTSpatialIndex()
+{
+	std::vector<NTGraphicObject *> objects;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (const auto &item : _entries) objects.push_back(item.first);
+	}
+
+	// Widgets lock themselves before the index, so the index lock is not held here
+	for (NTGraphicObject *object : objects) {
+		std::lock_guard<std::mutex> lock(object->_mutex);
+		if (object->_index == this) object->_index = nullptr;
+	}
+}
+
+// Adds a widget on top of the others
+void NTSpatialIndex::insert(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> object_lock(object->_mutex);
+	if (object->_index && object->_index != this) {
+		object->_index->erase(object);
+	}
+	object->_index = this;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto result = _entries.emplace(object, Entry{object, {0, 0, 0, 0}, _order, 0});
+	if (!result.second) return;
+	_order++;
+
+	Entry *entry = &result.first->second;
+	entry->rect = object->area();
+	link(entry);
+}
+
+// Removes a widget
+void NTSpatialIndex::remove(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> object_lock(object->_mutex);
+	if (object->_index != this) return;
+	erase(object);
+	object->_index = nullptr;
+}
+
+// Gets the widgets that overlap the area
+void NTSpatialIndex::query(const nt::Rect &area, std::vector<NTGraphicObject *> &result) const
+{
+	result.clear();
+	if (area.width <= 0 || area.height <= 0) return;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<const Entry *> found;
+
+	int bx0 = floorDiv(area.x, _bucketWidth);
+	int by0 = floorDiv(area.y, _bucketHeight);
+	int bx1 = floorDiv(area.x + area.width - 1, _bucketWidth);
+	int by1 = floorDiv(area.y + area.height - 1, _bucketHeight);
+	uint64_t buckets = static_cast<uint64_t>(bx1 - bx0 + 1) * (by1 - by0 + 1);
+
+	if (buckets > _entries.size()) {
+		// Area larger than the index: checking every widget is cheaper
+		for (const auto &item : _entries) {
+			if (nt::overlaps(item.second.rect, area)) found.push_back(&item.second);
+		}
+	} else {
+		uint64_t stamp = ++_stamp;
+		for (int by = by0; by <= by1; by++) {
+			for (int bx = bx0; bx <= bx1; bx++) {
+				auto bucket = _buckets.find(key(bx, by));
+				if (bucket == _buckets.end()) continue;
+				for (const Entry *entry : bucket->second) {
+					if (entry->stamp == stamp) continue;
+					entry->stamp = stamp;
+					if (nt::overlaps(entry->rect, area)) found.push_back(entry);
+				}
+			}
+		}
+	}
+
+	std::sort(found.begin(), found.end(), [](const Entry *a, const Entry *b) { return a->order < b->order; });
+	result.reserve(found.size());
+	for (const Entry *entry : found) result.push_back(entry->object);
+}
+
+// Gets the top-most widget that covers the cell
+NTGraphicObject *NTSpatialIndex::at(int x, int y) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto bucket = _buckets.find(key(floorDiv(x, _bucketWidth), floorDiv(y, _bucketHeight)));
+	if (bucket == _buckets.end()) return nullptr;
+
+	const nt::Rect point = {x, y, 1, 1};
+	const Entry *top = nullptr;
+	for (const Entry *entry : bucket->second) {
+		if (nt::overlaps(entry->rect, point) && (!top || entry->order > top->order)) top = entry;
+	}
+	return top ? top->object : nullptr;
+}
+
+// Gets the number of widgets
+size_t NTSpatialIndex::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _entries.size();
+}
+
+// Moves the widget entry to new bounds
+void NTSpatialIndex::move(NTGraphicObject *object, const nt::Rect &rect)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto item = _entries.find(object);
+	if (item == _entries.end()) return;
+
+	Entry *entry = &item->second;
+	const nt::Rect &old = entry->rect;
+	if (old.x == rect.x && old.y == rect.y && old.width == rect.width && old.height == rect.height) return;
+
+	unlink(entry);
+	entry->rect = rect;
+	link(entry);
+}
+
+// Removes the widget entry
+void NTSpatialIndex::erase(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto item = _entries.find(object);
+	if (item == _entries.end()) return;
+	unlink(&item->second);
+	_entries.erase(item);
+}
+
+// Adds the entry to the buckets of its bounds
+void NTSpatialIndex::link(Entry *entry)
+{
+	const nt::Rect &rect = entry->rect;
+	if (rect.width <= 0 || rect.height <= 0) return;
+
+	int bx1 = floorDiv(rect.x + rect.width - 1, _bucketWidth);
+	int by1 = floorDiv(rect.y + rect.height - 1, _bucketHeight);
+	for (int by = floorDiv(rect.y, _bucketHeight); by <= by1; by++) {
+		for (int bx = floorDiv(rect.x, _bucketWidth); bx <= bx1; bx++) {
+			_buckets[key(bx, by)].push_back(entry);
+		}
+	}
+}
+
+// Removes the entry from the buckets of its bounds
+void NTSpatialIndex::unlink(Entry *entry)
+{
+	const nt::Rect &rect = entry->rect;
+	if (rect.width <= 0 || rect.height <= 0) return;
+
+	int bx1 = floorDiv(rect.x + rect.width - 1, _bucketWidth);
+	int by1 = floorDiv(rect.y + rect.height - 1, _bucketHeight);
+	for (int by = floorDiv(rect.y, _bucketHeight); by <= by1; by++) {
+		for (int bx = floorDiv(rect.x, _bucketWidth); bx <= bx1; bx++) {
+			auto bucket = _buckets.find(key(bx, by));
+			if (bucket == _buckets.end()) continue;
+			std::vector<Entry *> &entries = bucket->second;
+			entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+			if (entries.empty()) _buckets.erase(bucket);
+		}
+	}
+}
+
+// Gets the bucket key
+uint64_t NTSpatialIndex::key(int bx, int by)
+{
+	return (static_cast<uint64_t>(static_cast<uint32_t>(bx)) << 32) | static_cast<uint32_t>(by);
+}
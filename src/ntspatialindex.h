@@ -0,0 +1,137 @@
+/*! \file       ntspatialindex.h
+ *  \brief      NT Spatial index module (header file).
+ *  \details    Contains the NTSpatialIndex class definitions: uniform grid of
+ *              widget bounds for area and point queries.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSPATIALINDEX_H_
+#define _NTSPATIALINDEX_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Standard hash map */
+#include <unordered_map>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Fixed width integers */
+#include <cstdint>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+
+/*! \class      NTSpatialIndex
+ *  \brief      Uniform grid of widget bounds.
+ *  \details    The screen is split into buckets of a fixed size and every
+ *              widget is listed in the buckets its bounds touch. Widgets keep
+ *              their entry up to date themselves: setx(), sety(),
+ *              setPosition() and size changes (text, image, sheet) move the
+ *              entry, and a destroyed widget leaves the index. Queries only
+ *              visit the buckets of the queried area, so they cost
+ *              O(affected widgets) instead of O(all widgets).
+ *
+ *              Widgets are ordered by insertion, which is the drawing order:
+ *              a widget inserted later is drawn on top. A widget is in at
+ *              most one index; copies of a widget are not indexed.
+ */
+class NTSpatialIndex
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      bucketWidth     Bucket width in columns
+	 *  \param      bucketHeight    Bucket height in rows
+	 */
+	NTSpatialIndex(int bucketWidth = 16, int bucketHeight = 4);
+
+	/*! \brief  Destructor (detaches the widgets) */
+	~NTSpatialIndex();
+
+	NTSpatialIndex(const NTSpatialIndex&) = delete;
+	NTSpatialIndex& operator=(const NTSpatialIndex&) = delete;
+
+	/*! \brief      Adds a widget on top of the others
+	 *  \details    A widget already in another index is moved to this one.
+	 *  \param      object  Widget
+	 */
+	void insert(NTGraphicObject *object);
+
+	/*! \brief      Removes a widget
+	 *  \param      object  Widget
+	 */
+	void remove(NTGraphicObject *object);
+
+	/*! \brief      Gets the widgets that overlap the area
+	 *  \param      area    Screen area
+	 *  \param      result  Widgets in drawing order (cleared first)
+	 */
+	void query(const nt::Rect &area, std::vector<NTGraphicObject *> &result) const;
+
+	/*! \brief      Gets the top-most widget that covers the cell
+	 *  \param      x   X coordinate of the cell
+	 *  \param      y   Y coordinate of the cell
+	 *  \return     Widget or nullptr if none
+	 */
+	NTGraphicObject *at(int x, int y) const;
+
+	/*! \brief      Gets the number of widgets
+	 *  \return     Number of widgets
+	 */
+	size_t size() const;
+
+private:
+	friend class NTGraphicObject;
+
+	/*!	\brief	Widget entry */
+	struct Entry {
+		NTGraphicObject *object;	/*!< Widget */
+		nt::Rect rect;				/*!< Bounds the buckets are built from */
+		uint64_t order;				/*!< Drawing order */
+		mutable uint64_t stamp;		/*!< Last query that visited the entry */
+	};
+
+	/*! \brief      Moves the widget entry to new bounds
+	 *  \details    Called by the widget with its _mutex held.
+	 *  \param      object  Widget
+	 *  \param      rect    New bounds
+	 */
+	void move(NTGraphicObject *object, const nt::Rect &rect);
+
+	/*! \brief      Removes the widget entry
+	 *  \details    Called by the widget with its _mutex held.
+	 *  \param      object  Widget
+	 */
+	void erase(NTGraphicObject *object);
+
+	/*! \brief      Adds the entry to the buckets of its bounds
+	 *  \details    Must be called with _mutex held.
+	 *  \param      entry   Widget entry
+	 */
+	void link(Entry *entry);
+
+	/*! \brief      Removes the entry from the buckets of its bounds
+	 *  \details    Must be called with _mutex held.
+	 *  \param      entry   Widget entry
+	 */
+	void unlink(Entry *entry);
+
+	/*! \brief      Gets the bucket key
+	 *  \param      bx  Bucket column
+	 *  \param      by  Bucket row
+	 *  \return     Key of the bucket
+	 */
+	static uint64_t key(int bx, int by);
+
+	mutable std::mutex _mutex;			/*!< Guards the entries and buckets */
+	int _bucketWidth;					/*!< Bucket width in columns */
+	int _bucketHeight;					/*!< Bucket height in rows */
+	uint64_t _order;					/*!< Next drawing order */
+	mutable uint64_t _stamp;			/*!< Current query */
+	std::unordered_map<NTGraphicObject *, Entry> _entries;				/*!< Entries of the widgets */
+	std::unordered_map<uint64_t, std::vector<Entry *>> _buckets;		/*!< Entries by bucket */
+};
+
+#endif // _NTSPATIALINDEX_H_
@@ -0,0 +1,170 @@
+/*!	\file		ntspritesheet.cpp
+ *	\brief		Implementation of the NTSpriteSheet class
+ *	\details	Contains method implementations for sprite sheets in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntspritesheet.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+namespace {
+	// Gets the glyph that covers the column: its first column and its bytes
+	std::pair<int, std::string_view> glyphAt(std::string_view row, const nt::TextLayout &layout, unsigned int x)
+	{
+		nt::TextColumn column = layout.column(x);
+		if (column.length == 0 && x > 0) {
+			column = layout.column(--x);
+		}
+		return {static_cast<int>(x), row.substr(column.offset, column.length)};
+	}
+
+	const std::vector<nt::Span> noSpans;	/*!< Delta of a frame to itself */
+}
+
+// Constructor from images
+NTSpriteSheet::NTSpriteSheet(const std::vector<nt::Image> &frames, unsigned int duration)
+	: _durations(frames.size(), duration), _width(0), _height(0)
+{
+	std::vector<std::vector<std::string_view>> rows(frames.size());
+	for (size_t f = 0; f < frames.size(); f++) {
+		rows[f].assign(frames[f].img.begin(), frames[f].img.end());
+	}
+	build(rows);
+}
+
+// Constructor from image sources
+NTSpriteSheet::NTSpriteSheet(const std::vector<std::shared_ptr<NTImageSource>> &frames, unsigned int duration)
+	: _durations(frames.size(), duration), _width(0), _height(0)
+{
+	std::vector<std::vector<std::string_view>> rows(frames.size());
+	for (size_t f = 0; f < frames.size(); f++) {
+		if (!frames[f] || frames[f]->load() != NT_OK) continue;
+		for (unsigned int y = 0; y < frames[f]->height(); y++) {
+			rows[f].push_back(frames[f]->row(y));
+		}
+	}
+	build(rows);
+}
+
+// Copies the frames into the atlas and computes the deltas
+void NTSpriteSheet::build(const std::vector<std::vector<std::string_view>> &rows)
+{
+	// Measure the frames
+	nt::TextLayout measure;
+	size_t bytes = 0;
+	for (const auto &frame : rows) {
+		_height = std::max<unsigned int>(_height, frame.size());
+		for (std::string_view row : frame) {
+			measure.assign(row);
+			_width = std::max(_width, measure.columns);
+			bytes += row.size();
+		}
+	}
+
+	// Copy every row into the atlas, padded with spaces to the frame width
+	size_t count = rows.size() * _height;
+	_atlas.reserve(bytes + count * _width);
+	_offsets.reserve(count + 1);
+	_layouts.resize(count);
+	for (const auto &frame : rows) {
+		for (unsigned int y = 0; y < _height; y++) {
+			std::string_view row = y < frame.size() ? frame[y] : std::string_view();
+			measure.assign(row);
+			_offsets.push_back(_atlas.size());
+			_atlas.append(row);
+			_atlas.append(_width - measure.columns, ' ');
+		}
+	}
+	_offsets.push_back(_atlas.size());
+
+	// Column maps of the padded rows
+	for (size_t i = 0; i < count; i++) {
+		_layouts[i].assign(std::string_view(_atlas).substr(_offsets[i], _offsets[i + 1] - _offsets[i]));
+	}
+
+	// Spans that differ between every frame and the next one
+	unsigned int frames = rows.size();
+	_deltas.resize(frames);
+	for (unsigned int f = 0; f < frames && frames > 1; f++) {
+		unsigned int g = (f + 1) % frames;
+		for (unsigned int y = 0; y < _height; y++) {
+			std::string_view a = row(f, y);
+			std::string_view b = row(g, y);
+			const nt::TextLayout &la = layout(f, y);
+			const nt::TextLayout &lb = layout(g, y);
+
+			// Equal rows have no spans
+			if (a == b) continue;
+
+			unsigned int x = 0;
+			while (x < _width) {
+				if (glyphAt(a, la, x) == glyphAt(b, lb, x)) {
+					x++;
+					continue;
+				}
+				unsigned int start = x;
+				while (x < _width && glyphAt(a, la, x) != glyphAt(b, lb, x)) x++;
+				_deltas[f].push_back({static_cast<unsigned short>(y), static_cast<unsigned short>(start),
+									  static_cast<unsigned short>(x - start)});
+			}
+		}
+	}
+}
+
+// Sets the frame duration
+void NTSpriteSheet::setDuration(unsigned int frame, unsigned int duration)
+{
+	if (frame < _durations.size()) _durations[frame] = duration;
+}
+
+// Gets the frame duration
+unsigned int NTSpriteSheet::duration(unsigned int frame) const
+{
+	return frame < _durations.size() ? _durations[frame] : 0;
+}
+
+// Gets the number of frames
+unsigned int NTSpriteSheet::frameCount() const
+{
+	return _deltas.size();
+}
+
+// Gets the frame width
+unsigned int NTSpriteSheet::width() const
+{
+	return _width;
+}
+
+// Gets the frame height
+unsigned int NTSpriteSheet::height() const
+{
+	return _height;
+}
+
+// Gets the frame row
+std::string_view NTSpriteSheet::row(unsigned int frame, unsigned int y) const
+{
+	size_t index = static_cast<size_t>(frame) * _height + y;
+	return std::string_view(_atlas).substr(_offsets[index], _offsets[index + 1] - _offsets[index]);
+}
+
+// Gets the column map of the frame row
+const nt::TextLayout &NTSpriteSheet::layout(unsigned int frame, unsigned int y) const
+{
+	return _layouts[static_cast<size_t>(frame) * _height + y];
+}
+
+// Gets the spans that differ between two frames
+const std::vector<nt::Span> *NTSpriteSheet::delta(unsigned int from, unsigned int to) const
+{
+	unsigned int frames = frameCount();
+	if (from >= frames || to >= frames) return nullptr;
+	if (from == to) return &noSpans;
+	if (to == (from + 1) % frames) return &_deltas[from];
+	if (from == (to + 1) % frames) return &_deltas[to];
+	return nullptr;
+}
@@ -0,0 +1,135 @@
+/*! \file       ntspritesheet.h
+ *  \brief      NT Sprite sheet module (header file).
+ *  \details    Contains the NTSpriteSheet class definitions: animation frames
+ *              stored in one shared atlas with precomputed inter-frame deltas.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSPRITESHEET_H_
+#define _NTSPRITESHEET_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard string view */
+#include <string_view>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+/*! \brief  Image source interface */
+#include "ntimagesource.h"
+
+/*!
+ *  \namespace nt
+ *  \brief     Namespace containing core types for NT project
+ */
+namespace nt {
+	/*!
+	 *  \struct Span
+	 *  \brief    Run of changed columns in one row
+	 */
+	struct Span {
+		unsigned short y;		/*!< Row */
+		unsigned short x;		/*!< First column */
+		unsigned short length;	/*!< Number of columns */
+	};
+
+} // namespace nt
+
+/*! \class      NTSpriteSheet
+ *  \brief      Immutable set of animation frames.
+ *  \details    All frames are padded with spaces to the same width and height
+ *              and stored in one atlas string. For every frame the sheet keeps
+ *              the spans that differ from the next frame (the last frame is
+ *              compared with the first one), so a widget stepping through the
+ *              frames redraws only those spans. The sheet is shared between
+ *              widgets with std::shared_ptr<const NTSpriteSheet>.
+ */
+class NTSpriteSheet
+{
+public:
+	/*! \brief      Constructor from images
+	 *  \param      frames      Frames of the animation
+	 *  \param      duration    Duration of every frame in milliseconds
+	 */
+	NTSpriteSheet(const std::vector<nt::Image> &frames, unsigned int duration = 100);
+
+	/*! \brief      Constructor from image sources (e.g. NTImageFile or NTAssetPack frames)
+	 *  \param      frames      Frames of the animation (loaded and copied into the atlas)
+	 *  \param      duration    Duration of every frame in milliseconds
+	 */
+	NTSpriteSheet(const std::vector<std::shared_ptr<NTImageSource>> &frames, unsigned int duration = 100);
+
+	/*! \brief      Sets the frame duration
+	 *  \details    Only for use while the sheet is being set up (before it is shared).
+	 *  \param      frame       Frame index
+	 *  \param      duration    Duration in milliseconds
+	 */
+	void setDuration(unsigned int frame, unsigned int duration);
+
+	/*! \brief      Gets the frame duration
+	 *  \param      frame   Frame index
+	 *  \return     Duration in milliseconds
+	 */
+	unsigned int duration(unsigned int frame) const;
+
+	/*! \brief      Gets the number of frames
+	 *  \return     Number of frames
+	 */
+	unsigned int frameCount() const;
+
+	/*! \brief      Gets the frame width
+	 *  \return     Width in columns
+	 */
+	unsigned int width() const;
+
+	/*! \brief      Gets the frame height
+	 *  \return     Height in rows
+	 */
+	unsigned int height() const;
+
+	/*! \brief      Gets the frame row
+	 *  \param      frame   Frame index
+	 *  \param      y       Row index
+	 *  \return     UTF-8 bytes of the row
+	 */
+	std::string_view row(unsigned int frame, unsigned int y) const;
+
+	/*! \brief      Gets the column map of the frame row
+	 *  \param      frame   Frame index
+	 *  \param      y       Row index
+	 *  \return     Column map
+	 */
+	const nt::TextLayout &layout(unsigned int frame, unsigned int y) const;
+
+	/*! \brief      Gets the spans that differ between two frames
+	 *  \param      from    Frame on the screen
+	 *  \param      to      Frame to be drawn
+	 *  \return     Pointer to the spans, or nullptr if the frames are not
+	 *              neighbours (a full redraw is needed then)
+	 */
+	const std::vector<nt::Span> *delta(unsigned int from, unsigned int to) const;
+
+private:
+	/*! \brief      Copies the frames into the atlas and computes the deltas
+	 *  \param      rows    Rows of every frame
+	 */
+	void build(const std::vector<std::vector<std::string_view>> &rows);
+
+	std::string _atlas;						/*!< All rows of all frames */
+	std::vector<size_t> _offsets;			/*!< Row offsets in the atlas (frameCount * height + 1) */
+	std::vector<nt::TextLayout> _layouts;	/*!< Column maps of the rows */
+	std::vector<std::vector<nt::Span>> _deltas;	/*!< Spans that differ from the next frame */
+	std::vector<unsigned int> _durations;	/*!< Frame durations in milliseconds */
+	unsigned int _width;					/*!< Frame width */
+	unsigned int _height;					/*!< Frame height */
+};
+
+#endif // _NTSPRITESHEET_H_
@@ -0,0 +1,126 @@
+/*!	\file		ntstreamserver.cpp
+ *	\brief		Implementation of the NTStreamServer class
+ *	\details	Contains method implementations for frame stream viewers in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntstreamserver.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+/*! \brief  C strings */
+#include <cstring>
+/*! \brief  Error numbers */
+#include <cerrno>
+
+/*! \brief  POSIX descriptors */
+#include <unistd.h>
+/*! \brief  Descriptor flags */
+#include <fcntl.h>
+/*! \brief  File status */
+#include <sys/stat.h>
+/*! \brief  Sockets */
+#include <sys/socket.h>
+/*! \brief  Unix domain sockets */
+#include <sys/un.h>
+
+// Constructor
+NTStreamServer::NTStreamServer()
+	: _fd(-1), _written(0) {}
+
+// Destructor
+NTStreamServer::~NTStreamServer()
+{
+	close();
+}
+
+// Listens on a socket
+int NTStreamServer::listen(const std::string &path)
+{
+	close();
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (path.empty() || path.size() >= sizeof(address.sun_path)) return NT_ERR;
+	std::memcpy(address.sun_path, path.c_str(), path.size());
+
+	// Only a socket left by an old server is replaced
+	struct stat status;
+	if (lstat(path.c_str(), &status) == 0) {
+		if (!S_ISSOCK(status.st_mode)) return NT_ERR;
+		unlink(path.c_str());
+	}
+
+	_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (_fd < 0) return NT_ERR;
+	if (bind(_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || ::listen(_fd, 8) != 0) {
+		::close(_fd);
+		_fd = -1;
+		return NT_ERR;
+	}
+	_path = path;
+	return NT_OK;
+}
+
+// Closes the socket and the streams
+void NTStreamServer::close()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_clients.clear();
+	if (_fd < 0) return;
+	::close(_fd);
+	unlink(_path.c_str());
+	_fd = -1;
+	_path.clear();
+}
+
+// Sends the changes of a frame to every viewer
+int NTStreamServer::present(const NTFrameBuffer &frame)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_written = 0;
+	if (_fd < 0) return NT_ERR;
+
+	// New viewers
+	for (;;) {
+		int client = accept4(_fd, nullptr, nullptr, SOCK_CLOEXEC);
+		if (client < 0) {
+			if (errno == EINTR) continue;
+			break;
+		}
+		_clients.push_back(std::make_unique<NTStreamSink>(client, true));
+	}
+
+	for (auto &client : _clients) {
+		if (client->present(frame) == NT_OK) _written += client->written();
+	}
+	_clients.erase(std::remove_if(_clients.begin(), _clients.end(),
+								  [](const std::unique_ptr<NTStreamSink> &client) { return !client->connected(); }),
+				   _clients.end());
+	return NT_OK;
+}
+
+// Sends the whole next frame to every viewer
+void NTStreamServer::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto &client : _clients) client->invalidate();
+}
+
+// Gets the number of cells sent by the last present()
+size_t NTStreamServer::written() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _written;
+}
+
+// Gets the number of viewers
+size_t NTStreamServer::clients() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _clients.size();
+}
@@ -0,0 +1,87 @@
+/*! \file       ntstreamserver.h
+ *  \brief      NT Stream server module (header file).
+ *  \details    Contains the NTStreamServer class definitions: frame streams
+ *              to the viewers of a Unix domain socket.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSTREAMSERVER_H_
+#define _NTSTREAMSERVER_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+/*! \brief  Frame streams */
+#include "ntstreamsink.h"
+
+/*! \class      NTStreamServer
+ *  \brief      Frame streams to the viewers of a Unix domain socket.
+ *  \details    Every present() takes the new connections and sends the
+ *              frame to every viewer through a stream sink of its own (see
+ *              NTStreamSink): a new viewer starts with a keyframe, a slow one
+ *              gets fewer, bigger diffs and does not hold up the others.
+ *              Viewers that are gone are dropped. The socket is removed when
+ *              the server closes.
+ */
+class NTStreamServer : public NTFrameSink
+{
+public:
+	/*! \brief  Constructor */
+	NTStreamServer();
+
+	/*! \brief  Destructor (closes the socket and the streams) */
+	~NTStreamServer() override;
+
+	NTStreamServer(const NTStreamServer&) = delete;
+	NTStreamServer& operator=(const NTStreamServer&) = delete;
+
+	/*! \brief      Listens on a socket
+	 *  \details    An old socket at the path is replaced; any other file is not.
+	 *  \param      path    Path of the socket
+	 *  \return     NT_OK if success, NT_ERR otherwise
+	 */
+	int listen(const std::string &path);
+
+	/*! \brief  Closes the socket and the streams */
+	void close();
+
+	/*! \brief      Sends the changes of a frame to every viewer
+	 *  \param      frame   Composed frame
+	 *  \return     NT_OK if listening (a viewer that is gone is not an error), NT_ERR otherwise
+	 */
+	int present(const NTFrameBuffer &frame) override;
+
+	/*! \brief  Sends the whole next frame to every viewer */
+	void invalidate() override;
+
+	/*! \brief      Gets the number of cells sent by the last present()
+	 *  \return     Cells sent to all viewers
+	 */
+	size_t written() const override;
+
+	/*! \brief      Gets the number of viewers
+	 *  \return     Connected viewers
+	 */
+	size_t clients() const;
+
+private:
+	mutable std::mutex _mutex;		/*!< Guards the socket and the streams */
+	int _fd;						/*!< Listening socket (-1 - closed) */
+	std::string _path;				/*!< Path of the socket */
+	std::vector<std::unique_ptr<NTStreamSink>> _clients;	/*!< Streams of the viewers */
+	size_t _written;				/*!< Cells sent by the last present() */
+};
+
+#endif // _NTSTREAMSERVER_H_
@@ -0,0 +1,131 @@
+/*!	\file		ntstreamsink.cpp
+ *	\brief		Implementation of the NTStreamSink class
+ *	\details	Contains method implementations for frame streams in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntstreamsink.h"
+
+/*! \brief  Error numbers */
+#include <cerrno>
+
+/*! \brief  POSIX descriptors */
+#include <unistd.h>
+/*! \brief  Descriptor flags */
+#include <fcntl.h>
+/*! \brief  Sockets */
+#include <sys/socket.h>
+
+// Constructor
+NTStreamSink::NTStreamSink(int fd, bool owned, bool blocking)
+	: _fd(fd), _owned(owned), _socket(false), _blocking(blocking), _connected(fd >= 0), _sent(0), _written(0), _bytes(0),
+	_start(std::chrono::steady_clock::now())
+{
+	int type;
+	socklen_t length = sizeof(type);
+	_socket = getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &length) == 0;
+	if (_connected && !blocking && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1) _connected = false;
+
+	_pending.assign(std::begin(nt::STREAM_MAGIC), std::end(nt::STREAM_MAGIC));
+	_pending.push_back(static_cast<char>(nt::STREAM_VERSION));
+}
+
+// Destructor
+NTStreamSink::~NTStreamSink()
+{
+	if (_owned && _fd >= 0) ::close(_fd);
+}
+
+// Sends the changes of a frame
+int NTStreamSink::present(const NTFrameBuffer &frame)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_written = 0;
+	receive();
+	flush();
+	if (!_connected) return NT_ERR;
+
+	// A slow peer gets the changes of the frames it missed with the next one
+	if (_sent < _pending.size()) return NT_OK;
+	_pending.clear();
+	_sent = 0;
+	auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start);
+	_written = _codec.encode(frame, time, _pending);
+	flush();
+	return _connected ? NT_OK : NT_ERR;
+}
+
+// Sends the whole next frame
+void NTStreamSink::invalidate()
+{
+	_codec.reset();
+}
+
+// Gets the number of cells sent by the last present()
+size_t NTStreamSink::written() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _written;
+}
+
+// Checks if the peer still takes the stream
+bool NTStreamSink::connected() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _connected;
+}
+
+// Gets the number of bytes sent
+size_t NTStreamSink::bytes() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _bytes;
+}
+
+// Gets the number of bytes waiting for the peer
+size_t NTStreamSink::pending() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pending.size() - _sent;
+}
+
+// Reads the requests of the viewer
+void NTStreamSink::receive()
+{
+	if (!_socket || !_connected) return;
+	char requests[64];
+	for (;;) {
+		ssize_t count = recv(_fd, requests, sizeof(requests), MSG_DONTWAIT);
+		if (count == 0) {
+			_connected = false;		// the viewer closed the socket
+			return;
+		}
+		if (count < 0) {
+			if (errno == EINTR) continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK) _connected = false;
+			return;
+		}
+		for (ssize_t i = 0; i < count; i++) {
+			if (requests[i] == nt::STREAM_KEYFRAME) _codec.reset();
+		}
+	}
+}
+
+// Sends what the descriptor takes
+void NTStreamSink::flush()
+{
+	while (_connected && _sent < _pending.size()) {
+		const char *data = _pending.data() + _sent;
+		size_t size = _pending.size() - _sent;
+		ssize_t count = _socket ? send(_fd, data, size, (_blocking ? 0 : MSG_DONTWAIT) | MSG_NOSIGNAL) : ::write(_fd, data, size);
+		if (count < 0) {
+			if (errno == EINTR) continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK) _connected = false;
+			return;
+		}
+		_sent += static_cast<size_t>(count);
+		_bytes += static_cast<size_t>(count);
+	}
+}
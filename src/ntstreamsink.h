@@ -0,0 +1,124 @@
+/*! \file       ntstreamsink.h
+ *  \brief      NT Stream sink module (header file).
+ *  \details    Contains the stream format and the NTStreamSink class
+ *              definitions: frames sent as cell diffs over a socket or a
+ *              pipe.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTSTREAMSINK_H_
+#define _NTSTREAMSINK_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Time durations */
+#include <chrono>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+/*! \brief  Frame records */
+#include "ntframecodec.h"
+
+/*!
+ *  \namespace nt
+ *  \brief     Namespace containing core types for NT project
+ */
+namespace nt {
+	constexpr char STREAM_MAGIC[4] = {'N', 'T', 'S', 'T'};	/*!< Stream magic */
+	constexpr unsigned char STREAM_VERSION = 1;				/*!< Stream format version */
+	constexpr char STREAM_KEYFRAME = 'K';					/*!< Viewer request: send a whole frame */
+}
+
+/*! \class      NTStreamSink
+ *  \brief      Frame output to a socket or a pipe.
+ *  \details    A stream is nt::STREAM_MAGIC, the version byte and frame
+ *              records (see NTFrameCodec), starting with a keyframe. A frame
+ *              with no change sends nothing.
+ *
+ *              A non-blocking sink never holds up present(): while a
+ *              record is still being sent, the next frames are not encoded,
+ *              and the first one after it carries all their changes. A
+ *              blocking sink waits for the peer to take every frame (for
+ *              tools that stream a recording). A viewer on a socket asks for a keyframe
+ *              by sending nt::STREAM_KEYFRAME. Writing to a pipe whose reader
+ *              is gone raises SIGPIPE, which the program must ignore.
+ */
+class NTStreamSink : public NTFrameSink
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      fd      Connected socket or write end of a pipe
+	 *  \param      owned   Close the descriptor in the destructor
+	 *  \param      blocking    Wait for the peer (false - the descriptor is made non-blocking)
+	 */
+	explicit NTStreamSink(int fd, bool owned = false, bool blocking = false);
+
+	/*! \brief  Destructor */
+	~NTStreamSink() override;
+
+	NTStreamSink(const NTStreamSink&) = delete;
+	NTStreamSink& operator=(const NTStreamSink&) = delete;
+
+	/*! \brief      Sends the changes of a frame
+	 *  \param      frame   Composed frame
+	 *  \return     NT_OK if success, NT_ERR if the peer is gone
+	 */
+	int present(const NTFrameBuffer &frame) override;
+
+	/*! \brief  Sends the whole next frame */
+	void invalidate() override;
+
+	/*! \brief      Gets the number of cells sent by the last present()
+	 *  \return     Number of cells
+	 */
+	size_t written() const override;
+
+	/*! \brief      Checks if the peer still takes the stream
+	 *  \return     false after a write error or the end of the socket
+	 */
+	bool connected() const;
+
+	/*! \brief      Gets the number of bytes sent
+	 *  \return     Bytes sent since the start of the stream
+	 */
+	size_t bytes() const;
+
+	/*! \brief      Gets the number of bytes waiting for the peer
+	 *  \return     Bytes of the record being sent
+	 */
+	size_t pending() const;
+
+private:
+	/*! \brief      Reads the requests of the viewer
+	 *  \details    Must be called with _mutex held.
+	 */
+	void receive();
+
+	/*! \brief      Sends what the descriptor takes
+	 *  \details    Must be called with _mutex held.
+	 */
+	void flush();
+
+	mutable std::mutex _mutex;		/*!< Guards the stream */
+	int _fd;						/*!< Descriptor */
+	bool _owned;					/*!< Descriptor is closed by the sink */
+	bool _socket;					/*!< Descriptor is a socket */
+	bool _blocking;					/*!< Writes wait for the peer */
+	bool _connected;				/*!< Peer takes the stream */
+	NTFrameCodec _codec;			/*!< Encoder of the frames */
+	std::string _pending;			/*!< Bytes being sent */
+	size_t _sent;					/*!< Bytes of _pending already sent */
+	size_t _written;				/*!< Cells of the last frame */
+	size_t _bytes;					/*!< Bytes sent */
+	std::chrono::steady_clock::time_point _start;	/*!< Time 0 of the stream */
+};
+
+#endif // _NTSTREAMSINK_H_
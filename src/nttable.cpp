@@ -0,0 +1,420 @@
+/*!	\file		nttable.cpp
+ *	\brief		Implementation of thread-safe NTTable class
+ *	\details	Contains method implementations for virtualized tables in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "nttable.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+// Gets the style of a cell
+unsigned char NTTableSource::style(size_t, unsigned int) const
+{
+	return 0;
+}
+
+// Orders the rows by a column
+bool NTTableSource::sort(unsigned int, bool)
+{
+	return false;
+}
+
+// Default constructor
+NTTable::NTTable(NTObject *parent, const std::string &name)
+	: NTTable(parent, name, 0, 0, 0, nullptr)
+{
+}
+
+// Parameterized constructor
+NTTable::NTTable(NTObject *parent, const std::string &name, int x, int y,
+				 unsigned int height, NTTableSource *source)
+	: NTGraphicObject(parent, name,	// parent, name
+	x, y,							// x, y coordinate of the header
+	0,								// Color pair
+	A_NORMAL,						// attr
+	NTA_NONE),						// ntattr
+	_source(source), _height(height), _headerPair(0), _top(0),
+	_sortColumn(-1), _ascending(true), _full(true)
+{
+}
+
+// Destructor
+NTTable::~NTTable() = default;
+
+// Sets the data source
+void NTTable::setSource(NTTableSource *source)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_source = source;
+	_sortColumn = -1;
+	flush();
+}
+
+// Gets the data source
+NTTableSource *NTTable::source() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _source;
+}
+
+// Adds a column
+unsigned int NTTable::addColumn(const std::string &title, unsigned int width)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_columns.push_back({title, width});
+	flush();
+	placed();
+	return static_cast<unsigned int>(_columns.size() - 1);
+}
+
+// Sets the width of a column
+void NTTable::setColumnWidth(unsigned int column, unsigned int width)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (column >= _columns.size() || _columns[column].width == width) return;
+	_columns[column].width = width;
+	_full = true;
+	_changed = true;
+	placed();
+}
+
+// Gets the width of a column
+unsigned int NTTable::columnWidth(unsigned int column) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return column < _columns.size() ? _columns[column].width : 0;
+}
+
+// Gets the number of columns
+unsigned int NTTable::columns() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return static_cast<unsigned int>(_columns.size());
+}
+
+// Sets the height
+void NTTable::setHeight(unsigned int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (height == _height) return;
+	_height = height;
+	_full = true;
+	_changed = true;
+	placed();
+}
+
+// Gets the height
+unsigned int NTTable::height() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _height;
+}
+
+// Gets the width
+unsigned int NTTable::width() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return static_cast<unsigned int>(area().width);
+}
+
+// Sets the color pair of the header
+void NTTable::setHeaderColorPair(unsigned char colorPair)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_headerPair = colorPair;
+	_full = true;
+	_changed = true;
+}
+
+// Sets the first visible row
+void NTTable::setTop(size_t row)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (row == _top) return;
+	_top = row;
+	_full = true;
+	_changed = true;
+}
+
+// Scrolls the rows
+void NTTable::scrollBy(long rows)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	size_t top = rows < 0 ? _top - std::min(_top, static_cast<size_t>(-rows))
+						  : _top + static_cast<size_t>(rows);
+	if (top == _top) return;
+	_top = top;
+	_full = true;
+	_changed = true;
+}
+
+// Gets the first visible row
+size_t NTTable::top() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _top;
+}
+
+// Orders the rows through the sorting hook of the source
+bool NTTable::sort(unsigned int column, bool ascending)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_source || column >= _columns.size() || !_source->sort(column, ascending)) return false;
+	_sortColumn = static_cast<int>(column);
+	_ascending = ascending;
+	flush();
+	return true;
+}
+
+// Gets the sort column
+int NTTable::sortColumn() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _sortColumn;
+}
+
+// Reports changed rows of the source
+void NTTable::rowsChanged(size_t row, size_t count)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	stale(row, row + count);
+}
+
+// Reports rows inserted into the source
+void NTTable::rowsInserted(size_t row, size_t count)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (count == 0) return;
+	stale(row, _top + bodyHeight());
+}
+
+// Reports rows removed from the source
+void NTTable::rowsRemoved(size_t row, size_t count)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (count == 0) return;
+	stale(row, _top + bodyHeight());
+}
+
+// Reports that the whole source changed
+void NTTable::reset()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	flush();
+}
+
+// Forces a full redraw on the next draw()
+void NTTable::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_full = true;
+	_changed = true;
+}
+
+// Gets the area covered by the table
+nt::Rect NTTable::area() const
+{
+	int width = 0;
+	for (const Column &column : _columns) width += static_cast<int>(column.width) + 1;
+	return {_x, _y, std::max(width - 1, 0), static_cast<int>(_height)};
+}
+
+// Gets the area of the stale rows
+nt::Rect NTTable::dirtyArea() const
+{
+	nt::Rect table = area();
+	unsigned int body = bodyHeight();
+	if (_full || _cache.size() != body) return table;
+
+	int first = -1, last = -1;
+	for (unsigned int r = 0; r < body; r++) {
+		const Slot &slot = _cache[(_top + r) % body];
+		if (slot.valid && slot.row == _top + r && !slot.stale) continue;
+		if (first < 0) first = static_cast<int>(r);
+		last = static_cast<int>(r);
+	}
+	if (first < 0) return {_x, _y, 0, 0};
+	return {_x, _y + 1 + first, table.width, last - first + 1};
+}
+
+// Cells are padded, so the table hides what is below it
+bool NTTable::opaque() const
+{
+	return !(_ntattr & NTA_SPACE_TRANSPARENT);
+}
+
+// Gets the number of body rows
+unsigned int NTTable::bodyHeight() const
+{
+	return _height > 0 ? _height - 1 : 0;
+}
+
+// Marks the visible rows of a range stale
+void NTTable::stale(size_t first, size_t last)
+{
+	unsigned int body = bodyHeight();
+	if (_cache.size() != body) return;	// cache is rebuilt on the next draw
+
+	first = std::max(first, _top);
+	last = std::min(last, _top + body);
+	for (size_t row = first; row < last; row++) {
+		Slot &slot = _cache[row % body];
+		if (slot.valid && slot.row == row) slot.stale = true;
+	}
+	if (first < last) _changed = true;
+}
+
+// Drops the cached rows and redraws the table
+void NTTable::flush()
+{
+	for (Slot &slot : _cache) slot.valid = false;
+	_full = true;
+	_changed = true;
+}
+
+// Fetches a row into its slot
+void NTTable::fetch(Slot &slot, size_t row, size_t count)
+{
+	bool fresh = !slot.valid || slot.row != row || slot.cells.size() != _columns.size();
+	slot.cells.resize(_columns.size());
+
+	for (unsigned int c = 0; c < _columns.size(); c++) {
+		std::string text;
+		unsigned char style = 0;
+		if (_source && row < count) {
+			text = _source->cell(row, c);
+			style = _source->style(row, c);
+		}
+
+		// Only the cells that changed are drawn again
+		Cell &cell = slot.cells[c];
+		if (fresh || cell.style != style || cell.text != text) {
+			cell.text = std::move(text);
+			cell.layout.assign(cell.text);
+			cell.style = style;
+			cell.dirty = true;
+		}
+	}
+
+	slot.row = row;
+	slot.valid = true;
+	slot.stale = false;
+}
+
+// Draws one cell padded to the column width
+int NTTable::drawCell(int y, int x, int width, int column, std::string_view text,
+					  const nt::TextLayout &layout, unsigned char style, int max_x)
+{
+	int result = NT_OK;
+
+	// Text clipped to the column
+	int columns = std::min(static_cast<int>(layout.columns), column);
+	if (columns > 0) {
+		const unsigned char *styles = nullptr;
+		if (style) {
+			_styles.assign(static_cast<size_t>(columns), style);
+			styles = _styles.data();
+		}
+		if (drawColumns(y, x, text, layout, 0, columns, max_x, styles) == ERR) result = ERR;
+	}
+
+	// Padding, then the separator in the style of the table
+	for (int i = std::max(columns, -x); i < width && x + i < max_x; i++) {
+		if (drawGlyph(y, x + i, " ", 1, i < column ? style : 0) == ERR) result = ERR;
+	}
+
+	return result;
+}
+
+// Draws the header and the changed cells
+int NTTable::draw()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int result = NT_OK;
+
+	// Get terminal dimensions
+	int max_y, max_x;
+	getmaxyx(window(), max_y, max_x);
+
+	nt::Rect table = area();
+
+	// Check if Y-position is out of bounds or no need to draw
+	if ( _y + table.height <= 0 || _y >= max_y ) {
+		result |= NT_ERR_RANGE_Y;	// Position Y completely out of bounds
+	}
+
+	// Check if X-position is out of bounds or no need to draw
+	if ( _x + table.width <= 0 || _x >= max_x) {
+		result |= NT_ERR_RANGE_X;	// Position X completely out of bounds
+	}
+
+	// Position (Y, X) completely out of bounds
+	if(NT_OK != result) return result;
+
+	// Keep the window inside the source
+	unsigned int body = bodyHeight();
+	size_t count = _source ? _source->rows() : 0;
+	size_t last = count > body ? count - body : 0;
+	if (_top > last) {
+		_top = last;
+		_full = true;
+	}
+	if (_cache.size() != body) {
+		_cache.assign(body, Slot{0, false, false, {}});
+		_full = true;
+	}
+
+	// Header
+	if (_full && _y >= 0) {
+		int x = _x;
+		for (size_t c = 0; c < _columns.size(); c++) {
+			const Column &column = _columns[c];
+			std::string title = column.title;
+			if (static_cast<int>(c) == _sortColumn) title += _ascending ? " ▲" : " ▼";
+			nt::TextLayout layout;
+			layout.assign(title);
+			int width = static_cast<int>(column.width) + (c + 1 < _columns.size() ? 1 : 0);
+			if (drawCell(_y, x, width, static_cast<int>(column.width), title, layout,
+						 _headerPair, max_x) == ERR) result = ERR;
+			x += width;
+		}
+	}
+
+	// Rows of the window: fetch the stale ones, draw the changed cells. A screen
+	// cleared all of dirtyArea(), so there every cell is drawn, clipped to it
+	bool all = _full || _occlusion;
+	for (unsigned int r = 0; r < body; r++) {
+		size_t row = _top + r;
+		Slot &slot = _cache[row % body];
+		if (!slot.valid || slot.row != row || slot.stale) fetch(slot, row, count);
+
+		int y = _y + 1 + static_cast<int>(r);
+		bool shown = y >= 0 && y < max_y;
+		int x = _x;
+		for (size_t c = 0; c < slot.cells.size(); c++) {
+			Cell &cell = slot.cells[c];
+			int column = static_cast<int>(_columns[c].width);
+			int width = column + (c + 1 < _columns.size() ? 1 : 0);
+			if (shown && (all || cell.dirty)) {
+				if (drawCell(y, x, width, column, cell.text, cell.layout, cell.style, max_x) == ERR) result = ERR;
+			}
+			cell.dirty = false;
+			x += width;
+		}
+	}
+	_full = false;
+
+	// If any fatal error occured then return ERR
+	if (result == ERR) {
+		return ERR;
+	}
+
+	// No fatal error occured
+	present();
+	_changed = false;
+	return result;
+}
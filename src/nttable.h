@@ -0,0 +1,323 @@
+/*! \file       nttable.h
+ *  \brief      NT Table module (header file).
+ *  \details    Contains the NTTableSource interface and the NTTable class
+ *              definitions: virtualized table over a lazy data source.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTTABLE_H_
+#define _NTTABLE_H_
+
+/*! \brief  Standard string library */
+#include <string>
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Mutex library */
+#include <mutex>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  UTF-8 text helpers */
+#include "ntutf8.h"
+
+/*! \class      NTTableSource
+ *  \brief      Data source of a table.
+ *  \details    The table asks the source only for the rows it shows. The
+ *              methods are called by NTTable::draw() with the mutex of the
+ *              table held, so they must not call the table back.
+ */
+class NTTableSource
+{
+public:
+	/*! \brief  Destructor */
+	virtual ~NTTableSource() = default;
+
+	/*! \brief      Gets the number of rows
+	 *  \return     Number of rows
+	 */
+	virtual size_t rows() const = 0;
+
+	/*! \brief      Gets the formatted text of a cell
+	 *  \param      row     Row index (less than rows())
+	 *  \param      column  Column index
+	 *  \return     UTF-8 text
+	 */
+	virtual std::string cell(size_t row, unsigned int column) const = 0;
+
+	/*! \brief      Gets the style of a cell
+	 *  \param      row     Row index (less than rows())
+	 *  \param      column  Column index
+	 *  \return     Color pair of the cell (0 - style of the table)
+	 */
+	virtual unsigned char style(size_t row, unsigned int column) const;
+
+	/*! \brief      Orders the rows by a column
+	 *  \details    Sorting hook: the source keeps the order (an index
+	 *              permutation, a sorted query...), the table only redraws.
+	 *  \param      column      Column index
+	 *  \param      ascending   true - ascending, false - descending order
+	 *  \return     true if sorted, false if the column can not be sorted
+	 */
+	virtual bool sort(unsigned int column, bool ascending);
+};
+
+/*! \class      NTTable
+ *  \brief      Virtualized table widget.
+ *  \details    Draws a header line and a window of rows of an NTTableSource.
+ *              Formatted cells are cached only for the rows in the window, in
+ *              a ring of slots indexed by row, so scrolling keeps the cache of
+ *              the rows that stay visible and a million-row source is never
+ *              read beyond the window. Row deltas (rowsChanged(),
+ *              rowsInserted(), rowsRemoved()) mark cached rows stale; draw()
+ *              fetches them again and redraws only the cells whose text or
+ *              style changed.
+ *
+ *              Cells are clipped to the column width and padded with spaces,
+ *              columns are separated by one space.
+ *  \extends    NTGraphicObject
+ */
+class NTTable : public NTGraphicObject
+{
+public:
+	/*! \brief      Default constructor
+	 *  \param      parent  Pointer to the parent object (default: nullptr)
+	 *  \param      name    Table name (default: empty string)
+	 */
+	NTTable(NTObject *parent = nullptr, const std::string &name = "");
+
+	/*! \brief      Parameterized constructor
+	 *  \param      parent  Pointer to the parent object
+	 *  \param      name    Table name
+	 *  \param      x       X coordinate
+	 *  \param      y       Y coordinate of the header
+	 *  \param      height  Height with the header in rows
+	 *  \param      source  Data source (not owned, may be nullptr)
+	 */
+	NTTable(NTObject *parent, const std::string &name, int x, int y,
+			unsigned int height, NTTableSource *source = nullptr);
+
+	/*! \brief  Destructor */
+	~NTTable();
+
+	NTTable(const NTTable&) = delete;
+	NTTable& operator=(const NTTable&) = delete;
+
+	/*! \brief      Sets the data source
+	 *  \param      source  Data source (not owned, may be nullptr)
+	 */
+	void setSource(NTTableSource *source);
+
+	/*! \brief      Gets the data source
+	 *  \return     Data source
+	 */
+	NTTableSource *source() const;
+
+	/*! \brief      Adds a column
+	 *  \param      title   UTF-8 title
+	 *  \param      width   Width in columns
+	 *  \return     Column index
+	 */
+	unsigned int addColumn(const std::string &title, unsigned int width);
+
+	/*! \brief      Sets the width of a column
+	 *  \param      column  Column index (ignored if out of range)
+	 *  \param      width   Width in columns
+	 */
+	void setColumnWidth(unsigned int column, unsigned int width);
+
+	/*! \brief      Gets the width of a column
+	 *  \param      column  Column index
+	 *  \return     Width in columns (0 if out of range)
+	 */
+	unsigned int columnWidth(unsigned int column) const;
+
+	/*! \brief      Gets the number of columns
+	 *  \return     Number of columns
+	 */
+	unsigned int columns() const;
+
+	/*! \brief      Sets the height
+	 *  \param      height  Height with the header in rows
+	 */
+	void setHeight(unsigned int height);
+
+	/*! \brief      Gets the height
+	 *  \return     Height with the header in rows
+	 */
+	unsigned int height() const;
+
+	/*! \brief      Gets the width
+	 *  \return     Width of all columns with the separators
+	 */
+	unsigned int width() const;
+
+	/*! \brief      Sets the color pair of the header
+	 *  \param      colorPair   Color pair (0 - style of the table)
+	 */
+	void setHeaderColorPair(unsigned char colorPair);
+
+	/*! \brief      Sets the first visible row
+	 *  \param      row     Row index (clamped to the source on draw)
+	 */
+	void setTop(size_t row);
+
+	/*! \brief      Scrolls the rows
+	 *  \param      rows    Rows to scroll down (negative - up)
+	 */
+	void scrollBy(long rows);
+
+	/*! \brief      Gets the first visible row
+	 *  \return     Row index
+	 */
+	size_t top() const;
+
+	/*! \brief      Orders the rows through the sorting hook of the source
+	 *  \param      column      Column index
+	 *  \param      ascending   true - ascending, false - descending order
+	 *  \return     true if sorted, false if there is no source or the column
+	 *              can not be sorted
+	 */
+	bool sort(unsigned int column, bool ascending = true);
+
+	/*! \brief      Gets the sort column
+	 *  \return     Column index, -1 if not sorted
+	 */
+	int sortColumn() const;
+
+	/*! \brief      Reports changed rows of the source
+	 *  \param      row     First changed row
+	 *  \param      count   Number of changed rows
+	 */
+	void rowsChanged(size_t row, size_t count = 1);
+
+	/*! \brief      Reports rows inserted into the source
+	 *  \details    The rows from the first inserted one to the end of the
+	 *              window are fetched again.
+	 *  \param      row     Index of the first inserted row
+	 *  \param      count   Number of inserted rows
+	 */
+	void rowsInserted(size_t row, size_t count = 1);
+
+	/*! \brief      Reports rows removed from the source
+	 *  \details    The rows from the first removed one to the end of the
+	 *              window are fetched again.
+	 *  \param      row     Index of the first removed row
+	 *  \param      count   Number of removed rows
+	 */
+	void rowsRemoved(size_t row, size_t count = 1);
+
+	/*! \brief      Reports that the whole source changed */
+	void reset();
+
+	/*! \brief      Forces a full redraw on the next draw() */
+	void invalidate() override;
+
+	/*! \brief     Draws the header and the changed cells
+	 *  \return    OK if success,
+	 *            ERR_RANGE if out of terminal bounds,
+	 *            ERR if other error occurred
+	 */
+	int draw() override;
+
+protected:
+	/*! \brief      Gets the area covered by the table
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect area() const override;
+
+	/*! \brief      Gets the area of the stale rows
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Position and size in cells
+	 */
+	nt::Rect dirtyArea() const override;
+
+	/*! \brief      Cells are padded, so the table hides what is below it
+	 *  \details    Must be called with _mutex held.
+	 *  \return     true unless spaces are transparent
+	 */
+	bool opaque() const override;
+
+private:
+	/*!	\brief	Column of the table */
+	struct Column {
+		std::string title;		/*!< UTF-8 title */
+		unsigned int width;		/*!< Width in columns */
+	};
+
+	/*!	\brief	Cached cell */
+	struct Cell {
+		std::string text;		/*!< Formatted text */
+		nt::TextLayout layout;	/*!< Column map of the text */
+		unsigned char style;	/*!< Color pair (0 - style of the table) */
+		bool dirty;				/*!< Changed since the last draw */
+	};
+
+	/*!	\brief	Cache slot of one visible row */
+	struct Slot {
+		size_t row;				/*!< Cached row */
+		bool valid;				/*!< Slot holds the row */
+		bool stale;				/*!< Row must be fetched again */
+		std::vector<Cell> cells;	/*!< Cells of the row */
+	};
+
+	/*! \brief      Gets the number of body rows
+	 *  \details    Must be called with _mutex held.
+	 *  \return     Rows below the header
+	 */
+	unsigned int bodyHeight() const;
+
+	/*! \brief      Marks the visible rows of a range stale
+	 *  \details    Must be called with _mutex held.
+	 *  \param      first   First row
+	 *  \param      last    Row after the last one
+	 */
+	void stale(size_t first, size_t last);
+
+	/*! \brief      Drops the cached rows and redraws the table
+	 *  \details    Must be called with _mutex held.
+	 */
+	void flush();
+
+	/*! \brief      Fetches a row into its slot
+	 *  \details    Must be called with _mutex held. Cells that did not
+	 *              change keep their dirty flag.
+	 *  \param      slot    Cache slot
+	 *  \param      row     Row index
+	 *  \param      count   Number of rows of the source (rows past it are empty)
+	 */
+	void fetch(Slot &slot, size_t row, size_t count);
+
+	/*! \brief      Draws one cell padded to the column width
+	 *  \details    Must be called with _mutex held.
+	 *  \param      y       Y coordinate
+	 *  \param      x       X coordinate
+	 *  \param      width   Width with the separator
+	 *  \param      column  Column width
+	 *  \param      text    UTF-8 text
+	 *  \param      layout  Column map of the text
+	 *  \param      style   Color pair (0 - style of the table)
+	 *  \param      max_x   Terminal width
+	 *  \return     OK if success, ERR if other error occurred
+	 */
+	int drawCell(int y, int x, int width, int column, std::string_view text,
+				 const nt::TextLayout &layout, unsigned char style, int max_x);
+
+	NTTableSource *_source;			/*!< Data source */
+	std::vector<Column> _columns;	/*!< Columns */
+	std::vector<Slot> _cache;		/*!< Cached rows, slot = row % bodyHeight() */
+	std::vector<unsigned char> _styles;	/*!< Style plane of one cell (kept to reuse the memory) */
+	unsigned int _height;			/*!< Height with the header */
+	unsigned char _headerPair;		/*!< Color pair of the header */
+	size_t _top;					/*!< First visible row */
+	int _sortColumn;				/*!< Sort column (-1 - none) */
+	bool _ascending;				/*!< Sort order */
+	bool _full;						/*!< Whole table needs drawing */
+};
+
+#endif // _NTTABLE_H_
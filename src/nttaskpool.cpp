@@ -0,0 +1,168 @@
+/*!	\file		nttaskpool.cpp
+ *	\brief		Implementation of the NTTaskPool class
+ *	\details	Contains method implementations for the work-stealing thread pool in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "nttaskpool.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+namespace {
+	thread_local const NTTaskPool *currentPool = nullptr;	// pool of the worker thread
+	thread_local size_t currentIndex = 0;					// queue of the worker thread
+}
+
+// Constructor
+NTTaskPool::NTTaskPool(unsigned int threads)
+	: _queued(0), _pending(0), _spread(0), _stolen(0), _stop(false), _ticket(0)
+{
+	if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+	for (unsigned int i = 0; i < threads; i++) _queues.push_back(std::make_unique<Queue>());
+	for (unsigned int i = 0; i < threads; i++) _workers.emplace_back(&NTTaskPool::worker, this, i);
+}
+
+// Destructor
+NTTaskPool::~NTTaskPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_sleepMutex);
+		_stop = true;
+	}
+	_wake.notify_all();
+	for (std::thread &thread : _workers) thread.join();
+}
+
+// Queues a task
+void NTTaskPool::submit(std::function<void()> task)
+{
+	// A worker keeps its own tasks, outside tasks are spread over the queues
+	size_t index = currentPool == this ? currentIndex : _spread.fetch_add(1) % _queues.size();
+	_pending++;
+	{
+		std::lock_guard<std::mutex> lock(_sleepMutex);
+		_queued++;
+	}
+	{
+		std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+		_queues[index]->tasks.push_back(std::move(task));
+	}
+	_wake.notify_one();
+}
+
+// Applies the finished results
+size_t NTTaskPool::publish()
+{
+	std::vector<Result> results;
+	{
+		std::lock_guard<std::mutex> lock(_resultMutex);
+		results.swap(_results);
+	}
+	for (Result &result : results) result.apply();
+	return results.size();
+}
+
+// Waits until no task is queued or running
+void NTTaskPool::wait()
+{
+	std::unique_lock<std::mutex> lock(_sleepMutex);
+	_idle.wait(lock, [this] { return _pending == 0; });
+}
+
+// Gets the number of worker threads
+unsigned int NTTaskPool::threads() const
+{
+	return static_cast<unsigned int>(_workers.size());
+}
+
+// Gets the number of tasks taken from the queue of another worker
+unsigned long NTTaskPool::stolen() const
+{
+	return _stolen.load(std::memory_order_relaxed);
+}
+
+// Gets the ticket of a new result
+unsigned long NTTaskPool::take(const void *key)
+{
+	std::lock_guard<std::mutex> lock(_resultMutex);
+	_ticket++;
+	if (key) _tickets[key] = _ticket;
+	return _ticket;
+}
+
+// Queues a finished result
+void NTTaskPool::post(const void *key, unsigned long ticket, std::function<void()> apply)
+{
+	std::lock_guard<std::mutex> lock(_resultMutex);
+	if (!key) {
+		_results.push_back({nullptr, std::move(apply)});
+		return;
+	}
+
+	// Only the newest result of a key is applied (an older one finishing
+	// after it finds no ticket)
+	auto last = _tickets.find(key);
+	if (last == _tickets.end() || last->second != ticket) return;
+	_tickets.erase(last);
+	for (Result &result : _results) {
+		if (result.key == key) {
+			result.apply = std::move(apply);
+			return;
+		}
+	}
+	_results.push_back({key, std::move(apply)});
+}
+
+// Takes a task: the newest of the own queue or the oldest of another
+bool NTTaskPool::next(size_t index, std::function<void()> &task)
+{
+	{
+		Queue &own = *_queues[index];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.tasks.empty()) {
+			task = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			return true;
+		}
+	}
+	for (size_t i = 1; i < _queues.size(); i++) {
+		Queue &other = *_queues[(index + i) % _queues.size()];
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.tasks.empty()) {
+			task = std::move(other.tasks.front());
+			other.tasks.pop_front();
+			_stolen.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+// Loop of a worker thread
+void NTTaskPool::worker(size_t index)
+{
+	currentPool = this;
+	currentIndex = index;
+
+	for (;;) {
+		std::function<void()> task;
+		if (next(index, task)) {
+			_queued--;
+			task();
+			task = nullptr;
+			if (--_pending == 0) {
+				std::lock_guard<std::mutex> lock(_sleepMutex);
+				_idle.notify_all();
+			}
+			continue;
+		}
+
+		// Sleep until a task is queued; exit when stopped and nothing is left
+		std::unique_lock<std::mutex> lock(_sleepMutex);
+		_wake.wait(lock, [this] { return _stop || _queued > 0; });
+		if (_stop && _queued == 0) return;
+	}
+}
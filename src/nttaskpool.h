@@ -0,0 +1,169 @@
+/*! \file       nttaskpool.h
+ *  \brief      NT Task Pool module (header file).
+ *  \details    Contains the NTTaskPool class definitions: work-stealing
+ *              thread pool for the content of widgets.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTTASKPOOL_H_
+#define _NTTASKPOOL_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Double-ended queue */
+#include <deque>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Condition variables */
+#include <condition_variable>
+/*! \brief  Threads */
+#include <thread>
+/*! \brief  Atomic operations */
+#include <atomic>
+/*! \brief  Function wrapper */
+#include <functional>
+/*! \brief  Standard hash map */
+#include <unordered_map>
+/*! \brief  Type traits */
+#include <type_traits>
+
+/*! \class      NTTaskPool
+ *  \brief      Work-stealing thread pool.
+ *  \details    Every worker has a queue of its own. A task submitted by a
+ *              worker goes to its queue, other tasks are spread over the
+ *              queues. A worker takes the newest task of its queue; an idle
+ *              worker steals the oldest task of another queue, so a burst
+ *              of tasks from one producer spreads over all cores.
+ *
+ *              schedule() splits a widget update into a produce step on a
+ *              worker (formatting, sampling, building rows) and an apply
+ *              step (the setters of the widget). Apply steps are queued and
+ *              run by publish() on the thread that draws: NTScreen and
+ *              NTTileRenderer call it before every frame (see setTaskPool()),
+ *              so a frame sees all the results finished before it or none of
+ *              them. Of the results scheduled with the same key only the
+ *              newest one is applied.
+ *
+ *              Tasks must not throw.
+ */
+class NTTaskPool
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      threads Worker threads (0 - one per core)
+	 */
+	explicit NTTaskPool(unsigned int threads = 0);
+
+	/*! \brief  Destructor (runs the queued tasks, then stops the workers) */
+	~NTTaskPool();
+
+	NTTaskPool(const NTTaskPool&) = delete;
+	NTTaskPool& operator=(const NTTaskPool&) = delete;
+
+	/*! \brief      Queues a task
+	 *  \param      task    Function run on a worker
+	 */
+	void submit(std::function<void()> task);
+
+	/*! \brief      Queues a task that produces the content of a widget
+	 *  \details    produce() runs on a worker, apply() with its result runs
+	 *              in the next publish(). A newer schedule() with the same
+	 *              key replaces an older result that was not applied yet.
+	 *  \tparam     Produce Callable without arguments
+	 *  \tparam     Apply   Callable that takes a T&
+	 *  \tparam     T       Content type (deduced from produce())
+	 *  \param      key     Key of the content, usually the widget (nullptr - none)
+	 *  \param      produce Function that computes the content
+	 *  \param      apply   Function that gives the content to the widget
+	 */
+	template <typename Produce, typename Apply, typename T = std::invoke_result_t<Produce>>
+	void schedule(const void *key, Produce produce, Apply apply)
+	{
+		unsigned long ticket = take(key);
+		submit([this, key, ticket, produce = std::move(produce), apply = std::move(apply)]() mutable {
+			auto result = std::make_shared<T>(produce());
+			post(key, ticket, [apply = std::move(apply), result]() mutable { apply(*result); });
+		});
+	}
+
+	/*! \brief      Applies the finished results
+	 *  \details    Called on the thread that draws, before a frame.
+	 *  \return     Number of results applied
+	 */
+	size_t publish();
+
+	/*! \brief  Waits until no task is queued or running */
+	void wait();
+
+	/*! \brief      Gets the number of worker threads
+	 *  \return     Number of threads
+	 */
+	unsigned int threads() const;
+
+	/*! \brief      Gets the number of tasks taken from the queue of another worker
+	 *  \return     Number of tasks
+	 */
+	unsigned long stolen() const;
+
+private:
+	/*!	\brief	Task queue of a worker */
+	struct Queue {
+		std::mutex mutex;							/*!< Guards the tasks */
+		std::deque<std::function<void()>> tasks;	/*!< Oldest task first */
+	};
+
+	/*!	\brief	Result waiting for publish() */
+	struct Result {
+		const void *key;				/*!< Key of the content (nullptr - none) */
+		std::function<void()> apply;	/*!< Gives the content to the widget */
+	};
+
+	/*! \brief      Gets the ticket of a new result
+	 *  \param      key     Key of the content (nullptr - none)
+	 *  \return     Ticket (newer results have greater tickets)
+	 */
+	unsigned long take(const void *key);
+
+	/*! \brief      Queues a finished result
+	 *  \details    A result older than the last scheduled one of its key is
+	 *              dropped. The newest one ends the ticket of its key.
+	 *  \param      key     Key of the content (nullptr - none)
+	 *  \param      ticket  Ticket of the result
+	 *  \param      apply   Gives the content to the widget
+	 */
+	void post(const void *key, unsigned long ticket, std::function<void()> apply);
+
+	/*! \brief      Takes a task: the newest of the own queue or the oldest of another
+	 *  \param      index   Queue of the worker
+	 *  \param      task    Taken task
+	 *  \return     true if a task was taken
+	 */
+	bool next(size_t index, std::function<void()> &task);
+
+	/*! \brief      Loop of a worker thread
+	 *  \param      index   Queue of the worker
+	 */
+	void worker(size_t index);
+
+	std::vector<std::unique_ptr<Queue>> _queues;	/*!< Queue of every worker */
+	std::vector<std::thread> _workers;		/*!< Worker threads */
+	std::mutex _sleepMutex;					/*!< Guards the sleep of the workers */
+	std::condition_variable _wake;			/*!< Signals a new task or the stop */
+	std::condition_variable _idle;			/*!< Signals that all tasks are done */
+	std::atomic<size_t> _queued;			/*!< Tasks in the queues */
+	std::atomic<size_t> _pending;			/*!< Tasks queued or running */
+	std::atomic<size_t> _spread;			/*!< Queue of the next outside task */
+	std::atomic<unsigned long> _stolen;		/*!< Tasks taken from other queues */
+	bool _stop;								/*!< Workers must exit */
+
+	std::mutex _resultMutex;				/*!< Guards the results */
+	std::vector<Result> _results;			/*!< Results waiting for publish() */
+	std::unordered_map<const void *, unsigned long> _tickets;	/*!< Last ticket of the keys with a result being produced */
+	unsigned long _ticket;					/*!< Last ticket */
+};
+
+#endif // _NTTASKPOOL_H_
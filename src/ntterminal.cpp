@@ -0,0 +1,137 @@
+/*!	\file		ntterminal.cpp
+ *	\brief		Implementation of the NTTerminal class
+ *	\details	Contains method implementations for terminal resize handling in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntterminal.h"
+
+/*! \brief  Signal handling */
+#include <csignal>
+/*! \brief  Error numbers */
+#include <cerrno>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Atomic operations */
+#include <atomic>
+
+/*! \brief  POSIX pipes and descriptors */
+#include <unistd.h>
+/*! \brief  Descriptor flags */
+#include <fcntl.h>
+/*! \brief  Terminal size query */
+#include <sys/ioctl.h>
+
+namespace {
+	int pipeFds[2] = {-1, -1};					// self-pipe: read end, write end
+	volatile sig_atomic_t signaled = 0;			// SIGWINCH arrived
+	struct sigaction previous;					// handler installed before ours
+	std::mutex installMutex;					// guards install()
+	std::atomic<int> cachedWidth{-1};			// terminal size of the last apply()
+	std::atomic<int> cachedHeight{-1};
+
+	// Async-signal-safe: raise the flag, wake the event loop, chain
+	void onResize(int signal)
+	{
+		int saved = errno;
+		signaled = 1;
+		if (pipeFds[1] >= 0) {
+			char byte = 1;
+			ssize_t written = ::write(pipeFds[1], &byte, 1);	// a full pipe already wakes the loop
+			(void)written;
+		}
+		if (!(previous.sa_flags & SA_SIGINFO) &&
+			previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+			previous.sa_handler(signal);
+		}
+		errno = saved;
+	}
+
+	// Sets the descriptor flags
+	bool configure(int fd)
+	{
+		return fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != -1 &&
+			   fcntl(fd, F_SETFD, FD_CLOEXEC) != -1;
+	}
+}
+
+// Installs the SIGWINCH handler
+bool NTTerminal::install()
+{
+	std::lock_guard<std::mutex> lock(installMutex);
+	if (pipeFds[0] >= 0) return true;
+
+	int fds[2];
+	if (pipe(fds) == -1) return false;
+	if (!configure(fds[0]) || !configure(fds[1])) {
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+	pipeFds[0] = fds[0];
+	pipeFds[1] = fds[1];
+
+	struct sigaction action = {};
+	action.sa_handler = onResize;
+	sigemptyset(&action.sa_mask);
+	action.sa_flags = SA_RESTART;
+	if (sigaction(SIGWINCH, &action, &previous) == -1) {
+		close(pipeFds[0]);
+		close(pipeFds[1]);
+		pipeFds[0] = pipeFds[1] = -1;
+		return false;
+	}
+	return true;
+}
+
+// Gets the read end of the self-pipe
+int NTTerminal::fd()
+{
+	return pipeFds[0];
+}
+
+// Checks if a resize is waiting to be applied
+bool NTTerminal::pending()
+{
+	return signaled != 0;
+}
+
+// Applies a waiting resize to ncurses
+bool NTTerminal::apply()
+{
+	if (!signaled) return false;
+	signaled = 0;
+
+	// Drain the pipe: any number of signals is one resize
+	if (pipeFds[0] >= 0) {
+		char buffer[64];
+		while (read(pipeFds[0], buffer, sizeof(buffer)) > 0) {}
+	}
+
+	struct winsize size = {};
+	if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == -1 || size.ws_row == 0 || size.ws_col == 0) {
+		return false;
+	}
+	if (size.ws_col == width() && size.ws_row == height()) return false;
+
+	resize_term(size.ws_row, size.ws_col);
+	cachedWidth = size.ws_col;
+	cachedHeight = size.ws_row;
+	return true;
+}
+
+// Gets the terminal width of the last apply()
+int NTTerminal::width()
+{
+	int width = cachedWidth;
+	return width >= 0 ? width : (stdscr ? getmaxx(stdscr) : 0);
+}
+
+// Gets the terminal height of the last apply()
+int NTTerminal::height()
+{
+	int height = cachedHeight;
+	return height >= 0 ? height : (stdscr ? getmaxy(stdscr) : 0);
+}
@@ -0,0 +1,65 @@
+/*! \file       ntterminal.h
+ *  \brief      NT Terminal module (header file).
+ *  \details    Contains the NTTerminal class definitions: SIGWINCH handling
+ *              through a self-pipe and the cached terminal size.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTTERMINAL_H_
+#define _NTTERMINAL_H_
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*! \class      NTTerminal
+ *  \brief      Terminal resize handling.
+ *  \details    install() sets a SIGWINCH handler that only raises a flag and
+ *              writes one byte to a self-pipe, so an event loop can wait for
+ *              resizes with poll() on fd() next to its other descriptors.
+ *              apply() is called once per frame (NTScreen::draw() does it):
+ *              it reads the new size of the terminal, resizes the ncurses
+ *              screens with resize_term() and caches the size. A handler
+ *              installed before (ncurses installs one) is still called.
+ */
+class NTTerminal
+{
+public:
+	NTTerminal() = delete;
+
+	/*! \brief      Installs the SIGWINCH handler
+	 *  \details    Safe to call more than once.
+	 *  \return     true if installed, false if the pipe or the handler
+	 *              could not be set up
+	 */
+	static bool install();
+
+	/*! \brief      Gets the read end of the self-pipe
+	 *  \return     File descriptor readable after a resize (-1 - not installed)
+	 */
+	static int fd();
+
+	/*! \brief      Checks if a resize is waiting to be applied
+	 *  \return     true if SIGWINCH arrived since the last apply()
+	 */
+	static bool pending();
+
+	/*! \brief      Applies a waiting resize to ncurses
+	 *  \details    Must be called from the thread that draws.
+	 *  \return     true if the size of the terminal changed
+	 */
+	static bool apply();
+
+	/*! \brief      Gets the terminal width of the last apply()
+	 *  \return     Width in columns (size of stdscr before the first resize)
+	 */
+	static int width();
+
+	/*! \brief      Gets the terminal height of the last apply()
+	 *  \return     Height in rows (size of stdscr before the first resize)
+	 */
+	static int height();
+};
+
+#endif // _NTTERMINAL_H_
@@ -0,0 +1,357 @@
+/*!	\file		nttilerenderer.cpp
+ *	\brief		Implementation of the NTTileRenderer class
+ *	\details	Contains method implementations for the multi-threaded compositor in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "nttilerenderer.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+/*! \brief  Terminal resize handling */
+#include "ntterminal.h"
+/*! \brief  Work-stealing task pool */
+#include "nttaskpool.h"
+
+namespace {
+	// Checks if an area covers another one
+	bool covers(const nt::Rect &a, const nt::Rect &b)
+	{
+		return a.x <= b.x && a.y <= b.y && a.x + a.width >= b.x + b.width && a.y + a.height >= b.y + b.height;
+	}
+}
+
+// Constructor
+NTTileRenderer::NTTileRenderer(unsigned int threads, int tileWidth, int tileHeight)
+	: _tileWidth(std::max(tileWidth, 1)), _tileHeight(std::max(tileHeight, 1)), _pool(nullptr), _full(true),
+	_rasterized(0), _composed(0), _written(0),
+	_job(nullptr), _count(0), _next(0), _busy(0), _generation(0), _stop(false)
+{
+	if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+	for (unsigned int i = 1; i < threads; i++) _workers.emplace_back(&NTTileRenderer::worker, this);
+}
+
+// Destructor
+NTTileRenderer::~NTTileRenderer()
+{
+	{
+		std::lock_guard<std::mutex> lock(_poolMutex);
+		_stop = true;
+	}
+	_wake.notify_all();
+	for (std::thread &thread : _workers) thread.join();
+}
+
+// Adds a widget on top of the others
+void NTTileRenderer::add(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (const Item &item : _items) {
+		if (item.object == object) return;
+	}
+	_items.push_back({object, std::make_unique<NTFrameBuffer>(), {0, 0, 0, 0}, false, false});
+}
+
+// Removes a widget
+void NTTileRenderer::remove(NTGraphicObject *object)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = std::find_if(_items.begin(), _items.end(), [object](const Item &item) { return item.object == object; });
+	if (it == _items.end()) return;
+	if (it->shown) _damage.push_back(it->rect);
+	_items.erase(it);
+}
+
+// Sets the tile size
+void NTTileRenderer::setTileSize(int width, int height)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_tileWidth = std::max(width, 1);
+	_tileHeight = std::max(height, 1);
+}
+
+// Gets the number of threads that draw
+unsigned int NTTileRenderer::threads() const
+{
+	return static_cast<unsigned int>(_workers.size() + 1);
+}
+
+// Sets the task pool whose results are applied before every frame
+void NTTileRenderer::setTaskPool(NTTaskPool *pool)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pool = pool;
+}
+
+// Redraws the whole screen on the next draw()
+void NTTileRenderer::invalidate()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_full = true;
+}
+
+// Attaches an output that mirrors the screen
+void NTTileRenderer::attach(NTFrameSink *sink)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!sink || std::find(_sinks.begin(), _sinks.end(), sink) != _sinks.end()) return;
+	sink->invalidate();
+	_sinks.push_back(sink);
+}
+
+// Detaches an output
+void NTTileRenderer::detach(NTFrameSink *sink)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sinks.erase(std::remove(_sinks.begin(), _sinks.end(), sink), _sinks.end());
+}
+
+// Gets the number of widgets drawn by the last draw()
+size_t NTTileRenderer::rasterized() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _rasterized;
+}
+
+// Gets the number of tiles composed by the last draw()
+size_t NTTileRenderer::composed() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _composed;
+}
+
+// Gets the number of cells written by the last draw()
+size_t NTTileRenderer::written() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _written;
+}
+
+// Runs a job for every index on the workers
+void NTTileRenderer::parallel(size_t count, const std::function<void(size_t)> &job)
+{
+	if (count == 0) return;
+	if (_workers.empty() || count == 1) {
+		for (size_t i = 0; i < count; i++) job(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_poolMutex);
+		_job = &job;
+		_count = count;
+		_next = 0;
+		_busy = _workers.size();
+		_generation++;
+	}
+	_wake.notify_all();
+	work();
+
+	std::unique_lock<std::mutex> lock(_poolMutex);
+	_done.wait(lock, [this] { return _busy == 0; });
+	_job = nullptr;
+}
+
+// Takes indices of the current job until none is left
+void NTTileRenderer::work()
+{
+	for (;;) {
+		size_t i = _next.fetch_add(1);
+		if (i >= _count) return;
+		(*_job)(i);
+	}
+}
+
+// Loop of a worker thread
+void NTTileRenderer::worker()
+{
+	unsigned long seen = 0;
+	std::unique_lock<std::mutex> lock(_poolMutex);
+	for (;;) {
+		_wake.wait(lock, [this, seen] { return _stop || _generation != seen; });
+		if (_stop) return;
+		seen = _generation;
+
+		lock.unlock();
+		work();
+		lock.lock();
+		if (--_busy == 0) _done.notify_one();
+	}
+}
+
+// Composes one tile from the layers
+void NTTileRenderer::compose(const nt::Rect &tile)
+{
+	// An opaque widget over the whole tile hides the widgets below it
+	size_t first = 0;
+	for (size_t i = _items.size(); i-- > 0;) {
+		if (_items[i].opaque && covers(_items[i].rect, tile)) {
+			first = i;
+			break;
+		}
+	}
+
+	_back.fill(tile, NTFrameBuffer::blank());
+	for (size_t i = first; i < _items.size(); i++) {
+		const NTFrameBuffer &layer = *_items[i].layer;
+		nt::Rect part = nt::intersect(layer.area(), tile);
+
+		// Cells of an opaque widget do not take the attrs of the cells below
+		if (_items[i].opaque) _back.fill(part, NTFrameBuffer::blank());
+
+		for (int y = part.y; y < part.y + part.height; y++) {
+			const NTFrameBuffer::Cell *from = layer.at(part.x, y);
+			NTFrameBuffer::Cell *to = _back.at(part.x, y);
+			for (int x = 0; x < part.width; x++, from++, to++) {
+				if (from->flags & NTF_GLYPH) {
+					std::copy(from->text, from->text + CCHARW_MAX, to->text);
+					to->flags = (to->flags & ~(NTF_WIDE | NTF_CONTINUATION)) |
+								(from->flags & (NTF_WIDE | NTF_CONTINUATION));
+				}
+				if (from->flags & NTF_ATTR) {
+					to->attr = from->attr;
+					to->pair = from->pair;
+				}
+			}
+		}
+	}
+}
+
+// Writes the changed cells of a tile to stdscr
+size_t NTTileRenderer::output(const nt::Rect &tile)
+{
+	size_t written = 0;
+	for (int y = tile.y; y < tile.y + tile.height; y++) {
+		for (int x = tile.x; x < tile.x + tile.width; x++) {
+			NTFrameBuffer::Cell &cell = *_back.at(x, y);
+
+			// Halves of wide glyphs broken by the glyphs over them become spaces
+			const NTFrameBuffer::Cell *left = _back.at(x - 1, y);
+			const NTFrameBuffer::Cell *right = _back.at(x + 1, y);
+			if ((cell.flags & NTF_CONTINUATION) && !(left && (left->flags & NTF_WIDE))) {
+				cell.text[0] = L' ';
+				cell.text[1] = 0;
+				cell.flags &= ~NTF_CONTINUATION;
+			}
+			if ((cell.flags & NTF_WIDE) && !(right && (right->flags & NTF_CONTINUATION))) {
+				cell.text[0] = L' ';
+				cell.text[1] = 0;
+				cell.flags &= ~NTF_WIDE;
+			}
+
+			NTFrameBuffer::Cell &shown = *_front.at(x, y);
+			if (NTFrameBuffer::same(cell, shown)) continue;
+			shown = cell;
+			if (cell.flags & NTF_CONTINUATION) continue;	// written with the left half
+
+			cchar_t output;
+			setcchar(&output, cell.text, cell.attr, cell.pair, nullptr);
+			mvwadd_wch(stdscr, y, x, &output);
+			written++;
+		}
+	}
+	return written;
+}
+
+// Draws the changed widgets
+int NTTileRenderer::draw()
+{
+	// Results of the widget tasks are applied together, before the frame
+	NTTaskPool *pool;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		pool = _pool;
+	}
+	if (pool) pool->publish();
+
+	NTTerminal::apply();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::atomic<int> result{NT_OK};
+
+	// New terminal size: nothing on the terminal is known
+	int max_y, max_x;
+	getmaxyx(stdscr, max_y, max_x);
+	nt::Rect screen = {0, 0, max_x, max_y};
+	if (screen != _front.area()) {
+		_front.reset(screen, NTFrameBuffer::empty());
+		_back.reset(screen, NTFrameBuffer::blank());
+		_full = true;
+	}
+
+	// Collect the damage and the widgets to draw: changed, moved and new ones
+	std::vector<nt::Rect> damage;
+	damage.swap(_damage);
+	if (_full) damage.push_back(screen);
+	_full = false;
+	std::vector<Item *> raster, serial;
+	std::vector<NTGraphicObject *> reset;
+	for (Item &item : _items) {
+		std::lock_guard<std::mutex> object_lock(item.object->_mutex);
+		nt::Rect rect = item.object->area();
+		item.opaque = item.object->opaque();
+		std::vector<Item *> &queue = item.object->serial() ? serial : raster;
+		if (!item.shown || rect != item.rect) {
+			if (item.shown) damage.push_back(item.rect);
+			damage.push_back(rect);
+			item.layer->reset(rect, NTFrameBuffer::empty());
+			item.rect = rect;
+			item.shown = true;
+			queue.push_back(&item);
+			reset.push_back(item.object);
+		} else if (item.object->dirty()) {
+			damage.push_back(item.object->dirtyArea());
+			queue.push_back(&item);
+		}
+	}
+	for (NTGraphicObject *object : reset) object->invalidate();	// empty layer: draw all of it
+
+	// Raster: every widget into its own layer, the ones that call ncurses on this thread
+	parallel(raster.size(), [&](size_t i) {
+		if (NTGraphicObject::drawClipped(raster[i]->object, nullptr, 0, nullptr, raster[i]->layer.get()) == ERR) {
+			result = ERR;
+		}
+	});
+	for (Item *item : serial) {
+		if (NTGraphicObject::drawClipped(item->object, nullptr, 0, nullptr, item->layer.get()) == ERR) result = ERR;
+	}
+	_rasterized = raster.size() + serial.size();
+
+	// Tiles touched by the damage (a column more on each side for wide glyphs)
+	int columns = (max_x + _tileWidth - 1) / _tileWidth;
+	int rows = (max_y + _tileHeight - 1) / _tileHeight;
+	std::vector<char> marked(static_cast<size_t>(columns) * rows, 0);
+	for (const nt::Rect &area : damage) {
+		nt::Rect part = nt::intersect({area.x - 1, area.y, area.width + 2, area.height}, screen);
+		if (part.width == 0) continue;
+		for (int row = part.y / _tileHeight; row <= (part.y + part.height - 1) / _tileHeight; row++) {
+			for (int column = part.x / _tileWidth; column <= (part.x + part.width - 1) / _tileWidth; column++) {
+				marked[static_cast<size_t>(row) * columns + column] = 1;
+			}
+		}
+	}
+	std::vector<nt::Rect> tiles;
+	for (int row = 0; row < rows; row++) {
+		for (int column = 0; column < columns; column++) {
+			if (!marked[static_cast<size_t>(row) * columns + column]) continue;
+			tiles.push_back(nt::intersect({column * _tileWidth, row * _tileHeight, _tileWidth, _tileHeight}, screen));
+		}
+	}
+
+	// Compose: every tile from the layers over it
+	parallel(tiles.size(), [&](size_t i) { compose(tiles[i]); });
+	_composed = tiles.size();
+
+	// Output: only the cells that differ from the terminal
+	_written = 0;
+	for (const nt::Rect &tile : tiles) _written += output(tile);
+	if (_written > 0) refresh();
+
+	// Mirrors: the same frame, each output with its own changes
+	for (NTFrameSink *sink : _sinks) sink->present(_back);
+
+	return result;
+}
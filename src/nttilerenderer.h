@@ -0,0 +1,217 @@
+/*! \file       nttilerenderer.h
+ *  \brief      NT Tile Renderer module (header file).
+ *  \details    Contains the NTTileRenderer class definitions: compositor
+ *              that rasterizes widgets and screen tiles on worker threads.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTTILERENDERER_H_
+#define _NTTILERENDERER_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Condition variables */
+#include <condition_variable>
+/*! \brief  Threads */
+#include <thread>
+/*! \brief  Atomic operations */
+#include <atomic>
+/*! \brief  Function wrapper */
+#include <functional>
+
+/*!	\brief	ncurses library */
+#include <ncurses.h>
+
+/*!	\brief	Base NT types */
+#include "nttypes.h"
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+/*! \brief  In-memory screen cells */
+#include "ntframebuffer.h"
+/*! \brief  Frame output interface */
+#include "ntframesink.h"
+
+class NTTaskPool;
+
+/*! \class      NTTileRenderer
+ *  \brief      Multi-threaded widget compositor.
+ *  \details    Draws a stack of widgets (the last added is on top) into
+ *              stdscr in three phases:
+ *              - raster: every changed widget draws itself into a frame
+ *                buffer of its own (its layer), the widgets in parallel;
+ *              - compose: the screen is split into tiles, and every tile
+ *                touched by the damage is composed from the layers of the
+ *                widgets over it, the tiles in parallel. A tile covered by
+ *                an opaque widget skips the widgets below it;
+ *              - output: one thread compares the composed frame with the
+ *                frame on the terminal and writes only the changed cells.
+ *
+ *              The composed frame can be mirrored to other outputs too
+ *              (see attach()): other terminals, recordings and streams.
+ *              The widgets are drawn and composed once; every output
+ *              keeps the frame it has and takes only its own changes.
+ *
+ *              ncurses is only called by the thread of draw(). Layers are
+ *              kept between frames, so unchanged widgets are not drawn and
+ *              widgets that redraw only their changes still work. Widgets
+ *              that call ncurses to draw (NTGraphicObject::serial(), such as
+ *              NTPanel) are drawn on the thread of draw() after the others.
+ *              The renderer does not own the widgets. A widget
+ *              must be removed from the renderer before it is destroyed.
+ */
+class NTTileRenderer
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      threads     Threads that draw (0 - one per core)
+	 *  \param      tileWidth   Tile width in columns
+	 *  \param      tileHeight  Tile height in rows
+	 */
+	explicit NTTileRenderer(unsigned int threads = 0, int tileWidth = 32, int tileHeight = 8);
+
+	/*! \brief  Destructor (stops the workers) */
+	~NTTileRenderer();
+
+	NTTileRenderer(const NTTileRenderer&) = delete;
+	NTTileRenderer& operator=(const NTTileRenderer&) = delete;
+
+	/*! \brief      Adds a widget on top of the others
+	 *  \param      object  Widget
+	 */
+	void add(NTGraphicObject *object);
+
+	/*! \brief      Removes a widget (its cells are cleared on the next draw)
+	 *  \param      object  Widget
+	 */
+	void remove(NTGraphicObject *object);
+
+	/*! \brief      Sets the tile size
+	 *  \param      width   Tile width in columns
+	 *  \param      height  Tile height in rows
+	 */
+	void setTileSize(int width, int height);
+
+	/*! \brief      Gets the number of threads that draw
+	 *  \return     Worker threads and the thread of draw()
+	 */
+	unsigned int threads() const;
+
+	/*! \brief      Sets the task pool whose results are applied before every frame
+	 *  \details    draw() calls NTTaskPool::publish() first, without the mutex
+	 *              held. The pool is not owned.
+	 *  \param      pool    Task pool (nullptr - none)
+	 */
+	void setTaskPool(NTTaskPool *pool);
+
+	/*! \brief  Redraws the whole screen on the next draw() */
+	void invalidate();
+
+	/*! \brief      Attaches an output that mirrors the screen
+	 *  \details    Every draw() presents the composed frame to the attached
+	 *              outputs after stdscr, from the thread of draw(). An output
+	 *              smaller than the screen shows its top left part. Outputs
+	 *              that may be slow (remote viewers) should be stream sinks,
+	 *              which never block the frame. The sink is not owned and
+	 *              must be detached before it is destroyed.
+	 *  \param      sink    Output (the whole frame is sent to it first)
+	 */
+	void attach(NTFrameSink *sink);
+
+	/*! \brief      Detaches an output
+	 *  \param      sink    Output
+	 */
+	void detach(NTFrameSink *sink);
+
+	/*! \brief      Gets the number of widgets drawn by the last draw()
+	 *  \return     Number of widgets
+	 */
+	size_t rasterized() const;
+
+	/*! \brief      Gets the number of tiles composed by the last draw()
+	 *  \return     Number of tiles
+	 */
+	size_t composed() const;
+
+	/*! \brief      Gets the number of cells written by the last draw()
+	 *  \return     Number of cells written to stdscr
+	 */
+	size_t written() const;
+
+	/*! \brief     Draws the changed widgets
+	 *  \details   Applies a pending terminal resize first (see NTTerminal).
+	 *             The attached outputs are presented even if nothing changed:
+	 *             an output that was busy catches up.
+	 *  \return    OK if success,
+	 *            ERR if a widget failed to draw
+	 */
+	int draw();
+
+private:
+	/*!	\brief	Widget of the renderer */
+	struct Item {
+		NTGraphicObject *object;				/*!< Widget */
+		std::unique_ptr<NTFrameBuffer> layer;	/*!< Cells drawn by the widget */
+		nt::Rect rect;							/*!< Bounds of the layer */
+		bool shown;								/*!< Widget was drawn at least once */
+		bool opaque;							/*!< Widget covers its bounds (this frame) */
+	};
+
+	/*! \brief      Runs a job for every index on the workers
+	 *  \details    The calling thread works too; returns when all are done.
+	 *  \param      count   Number of indices
+	 *  \param      job     Function of the index
+	 */
+	void parallel(size_t count, const std::function<void(size_t)> &job);
+
+	/*! \brief  Takes indices of the current job until none is left */
+	void work();
+
+	/*! \brief  Loop of a worker thread */
+	void worker();
+
+	/*! \brief      Composes one tile from the layers
+	 *  \details    Must be called with _mutex held.
+	 *  \param      tile    Screen area of the tile
+	 */
+	void compose(const nt::Rect &tile);
+
+	/*! \brief      Writes the changed cells of a tile to stdscr
+	 *  \details    Must be called with _mutex held.
+	 *  \param      tile    Screen area of the tile
+	 *  \return     Number of cells written
+	 */
+	size_t output(const nt::Rect &tile);
+
+	mutable std::mutex _mutex;				/*!< Guards the widget stack and the frames */
+	std::vector<Item> _items;				/*!< Widgets from the bottom to the top */
+	std::vector<nt::Rect> _damage;			/*!< Areas damaged by removed widgets */
+	std::vector<NTFrameSink *> _sinks;		/*!< Outputs that mirror the screen */
+	NTFrameBuffer _front;					/*!< Frame on the terminal */
+	NTFrameBuffer _back;					/*!< Frame being composed */
+	int _tileWidth;							/*!< Tile width in columns */
+	int _tileHeight;						/*!< Tile height in rows */
+	NTTaskPool *_pool;						/*!< Task pool of the widgets (nullptr - none) */
+	bool _full;								/*!< Whole screen needs drawing */
+	size_t _rasterized;						/*!< Widgets drawn by the last draw() */
+	size_t _composed;						/*!< Tiles composed by the last draw() */
+	size_t _written;						/*!< Cells written by the last draw() */
+
+	std::vector<std::thread> _workers;		/*!< Worker threads */
+	std::mutex _poolMutex;					/*!< Guards the job */
+	std::condition_variable _wake;			/*!< Signals a new job or the stop */
+	std::condition_variable _done;			/*!< Signals the end of a job */
+	const std::function<void(size_t)> *_job;	/*!< Current job (nullptr - none) */
+	size_t _count;							/*!< Indices of the current job */
+	std::atomic<size_t> _next;				/*!< Next index to take */
+	size_t _busy;							/*!< Workers still in the current job */
+	unsigned long _generation;				/*!< Number of the current job */
+	bool _stop;								/*!< Workers must exit */
+};
+
+#endif // _NTTILERENDERER_H_
@@ -0,0 +1,303 @@
+/*!	\file		nttimerwheel.cpp
+ *	\brief		Implementation of the NTTimerWheel class
+ *	\details	Contains method implementations for the timer service in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "nttimerwheel.h"
+
+/*! \brief  Standard algorithms */
+#include <algorithm>
+
+// Constructor
+NTTimerWheel::NTTimerWheel(std::chrono::microseconds resolution)
+	: _start(std::chrono::steady_clock::now()), _resolution(std::max(resolution, std::chrono::microseconds(1))),
+	_now(0), _count(0)
+{
+	for (auto &level : _slots) std::fill(std::begin(level), std::end(level), -1);
+	std::fill(std::begin(_occupied), std::end(_occupied), 0);
+}
+
+// Destructor
+NTTimerWheel::~NTTimerWheel() = default;
+
+// Adds a one-shot timer
+NTTimerWheel::Id NTTimerWheel::after(std::chrono::microseconds delay, std::function<void()> callback)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return insert(delay, 0, std::move(callback));
+}
+
+// Adds a periodic timer
+NTTimerWheel::Id NTTimerWheel::every(std::chrono::microseconds period, std::function<void()> callback)
+{
+	uint64_t period_ticks = period.count() > 0 ? (period.count() + _resolution.count() - 1) / _resolution.count() : 1;
+	std::lock_guard<std::mutex> lock(_mutex);
+	return insert(_resolution * static_cast<long long>(period_ticks), period_ticks, std::move(callback));
+}
+
+// Cancels a timer
+bool NTTimerWheel::cancel(Id id, bool wait)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	int32_t index = find(id);
+	if (index >= 0) {
+		if (_timers[index].linked) unlink(index);
+		release(index);
+	}
+
+	// A call running on another thread returns first
+	if (wait) {
+		std::thread::id self = std::this_thread::get_id();
+		_finished.wait(lock, [this, id, self] {
+			return std::none_of(_running.begin(), _running.end(),
+				[id, self](const std::pair<Id, std::thread::id> &call) { return call.first == id && call.second != self; });
+		});
+	}
+	return index >= 0;
+}
+
+// Checks if a timer is pending
+bool NTTimerWheel::active(Id id) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return find(id) >= 0;
+}
+
+// Gets the number of pending timers
+size_t NTTimerWheel::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _count;
+}
+
+// Gets the nearest deadline
+std::chrono::steady_clock::time_point NTTimerWheel::next() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// Slots of a level are in time order, so the first one of each level has its earliest timer
+	uint64_t first = UINT64_MAX;
+	for (int level = 0; level < Levels; level++) {
+		uint64_t tick;
+		int slot = upcoming(level, tick);
+		if (slot < 0) continue;
+		for (int32_t index = _slots[level][slot]; index >= 0; index = _timers[index].next) {
+			first = std::min(first, _timers[index].expiry);
+		}
+	}
+	if (first == UINT64_MAX) return std::chrono::steady_clock::time_point::max();
+	return _start + _resolution * static_cast<long long>(first);
+}
+
+// Runs the timers that are due
+size_t NTTimerWheel::advance(std::chrono::steady_clock::time_point now)
+{
+	uint64_t target = ticks(now);
+	std::vector<Id> due;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Jump over the ticks with nothing to fire or to move down
+		while (_now < target) {
+			uint64_t first = UINT64_MAX;
+			for (int level = 0; level < Levels; level++) {
+				uint64_t tick;
+				if (upcoming(level, tick) >= 0) first = std::min(first, tick);
+			}
+			if (first > target) {
+				_now = target;
+				break;
+			}
+			_now = first - 1;
+			tick(target, due);
+		}
+	}
+
+	// Callbacks run unlocked; a timer cancelled by an earlier callback is skipped.
+	// The running call is recorded, so cancel() can wait for it
+	size_t called = 0;
+	std::pair<Id, std::thread::id> call(0, std::this_thread::get_id());
+	for (Id id : due) {
+		std::shared_ptr<std::function<void()>> callback;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			int32_t index = find(id);
+			if (index < 0) continue;
+			callback = _timers[index].callback;
+			if (!_timers[index].period) release(index);
+			call.first = id;
+			_running.push_back(call);
+		}
+		(*callback)();
+		called++;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_running.erase(std::find(_running.begin(), _running.end(), call));
+		}
+		_finished.notify_all();
+	}
+	return called;
+}
+
+// Adds a timer
+NTTimerWheel::Id NTTimerWheel::insert(std::chrono::microseconds delay, uint64_t period, std::function<void()> callback)
+{
+	int32_t index;
+	if (!_free.empty()) {
+		index = _free.back();
+		_free.pop_back();
+	} else {
+		index = static_cast<int32_t>(_timers.size());
+		_timers.push_back({0, 0, nullptr, 0, -1, -1, 0, 0, false, false});
+	}
+
+	// Delays count from the current time, even if advance() is behind; a timer never fires early
+	auto now = std::chrono::steady_clock::now();
+	uint64_t deadline = ticks(now + std::max(delay, std::chrono::microseconds(0)) + _resolution - std::chrono::microseconds(1));
+	Timer &timer = _timers[index];
+	timer.expiry = std::max({deadline, ticks(now) + 1, _now + 1});
+	timer.period = period;
+	timer.callback = std::make_shared<std::function<void()>>(std::move(callback));
+	timer.used = true;
+	_count++;
+	link(index);
+	return (static_cast<uint64_t>(timer.generation) << 32) | static_cast<uint32_t>(index + 1);
+}
+
+// Finds the entry of a pending timer
+int32_t NTTimerWheel::find(Id id) const
+{
+	uint32_t index = static_cast<uint32_t>(id) - 1;
+	uint32_t generation = static_cast<uint32_t>(id >> 32);
+	if (id == 0 || index >= _timers.size()) return -1;
+	const Timer &timer = _timers[index];
+	if (!timer.used || timer.generation != generation) return -1;
+	return static_cast<int32_t>(index);
+}
+
+// Puts a timer into the slot of its expiry
+void NTTimerWheel::link(int32_t index)
+{
+	Timer &timer = _timers[index];
+	uint64_t expiry = std::max(timer.expiry, _now);
+	uint64_t delta = expiry - _now;
+
+	int level = 0;
+	while (level < Levels - 1 && delta >= (uint64_t(1) << (Bits * (level + 1)))) level++;
+
+	// Beyond the wheel: wait in the last slot it reaches
+	uint64_t span = uint64_t(1) << (Bits * Levels);
+	if (delta >= span) expiry = _now + span - 1;
+
+	int slot = static_cast<int>((expiry >> (Bits * level)) & (Slots - 1));
+	timer.level = static_cast<uint8_t>(level);
+	timer.slot = static_cast<uint8_t>(slot);
+	timer.prev = -1;
+	timer.next = _slots[level][slot];
+	if (timer.next >= 0) _timers[timer.next].prev = index;
+	_slots[level][slot] = index;
+	_occupied[level] |= uint64_t(1) << slot;
+	timer.linked = true;
+}
+
+// Takes a timer out of its slot
+void NTTimerWheel::unlink(int32_t index)
+{
+	Timer &timer = _timers[index];
+	if (timer.prev >= 0) {
+		_timers[timer.prev].next = timer.next;
+	} else {
+		_slots[timer.level][timer.slot] = timer.next;
+	}
+	if (timer.next >= 0) _timers[timer.next].prev = timer.prev;
+	if (_slots[timer.level][timer.slot] < 0) _occupied[timer.level] &= ~(uint64_t(1) << timer.slot);
+	timer.prev = timer.next = -1;
+	timer.linked = false;
+}
+
+// Frees the entry of a timer
+void NTTimerWheel::release(int32_t index)
+{
+	Timer &timer = _timers[index];
+	timer.used = false;
+	timer.callback.reset();
+	timer.generation++;
+	_free.push_back(index);
+	_count--;
+}
+
+// Takes all timers of a slot
+int32_t NTTimerWheel::take(int level, int slot)
+{
+	int32_t first = _slots[level][slot];
+	_slots[level][slot] = -1;
+	_occupied[level] &= ~(uint64_t(1) << slot);
+	for (int32_t index = first; index >= 0; index = _timers[index].next) _timers[index].linked = false;
+	return first;
+}
+
+// Gets the first occupied slot of a level after the current tick
+int NTTimerWheel::upcoming(int level, uint64_t &tick) const
+{
+	uint64_t bits = _occupied[level];
+	if (!bits) return -1;
+
+	// Rotate the mask so the slot after the current one is bit 0
+	int shift = Bits * level;
+	uint64_t block = _now >> shift;
+	int from = static_cast<int>((block + 1) & (Slots - 1));
+	uint64_t rotated = from ? (bits >> from) | (bits << (Slots - from)) : bits;
+	int slot = (from + __builtin_ctzll(rotated)) & (Slots - 1);
+
+	uint64_t distance = (static_cast<uint64_t>(slot) - block) & (Slots - 1);
+	if (distance == 0) distance = Slots;
+	tick = (block + distance) << shift;
+	return slot;
+}
+
+// Processes the next tick
+void NTTimerWheel::tick(uint64_t target, std::vector<Id> &due)
+{
+	_now++;
+
+	// Slots of higher levels that start now move down, the highest first
+	for (int level = Levels - 1; level > 0; level--) {
+		if (_now & ((uint64_t(1) << (Bits * level)) - 1)) continue;
+		int32_t index = take(level, static_cast<int>((_now >> (Bits * level)) & (Slots - 1)));
+		while (index >= 0) {
+			int32_t next = _timers[index].next;
+			link(index);
+			index = next;
+		}
+	}
+
+	int32_t index = take(0, static_cast<int>(_now & (Slots - 1)));
+	while (index >= 0) {
+		int32_t next = _timers[index].next;
+		Timer &timer = _timers[index];
+		if (timer.expiry > _now) {
+			link(index);
+		} else {
+			due.push_back((static_cast<uint64_t>(timer.generation) << 32) | static_cast<uint32_t>(index + 1));
+
+			// A late periodic timer fires once and keeps its phase
+			if (timer.period) {
+				timer.expiry += timer.period;
+				if (timer.expiry <= target) timer.expiry += timer.period * ((target - timer.expiry) / timer.period + 1);
+				link(index);
+			}
+		}
+		index = next;
+	}
+}
+
+// Converts a time to ticks
+uint64_t NTTimerWheel::ticks(std::chrono::steady_clock::time_point time) const
+{
+	if (time <= _start) return 0;
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(time - _start);
+	return static_cast<uint64_t>(elapsed.count() / _resolution.count());
+}
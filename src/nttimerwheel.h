@@ -0,0 +1,215 @@
+/*! \file       nttimerwheel.h
+ *  \brief      NT Timer Wheel module (header file).
+ *  \details    Contains the NTTimerWheel class definitions: one-shot and
+ *              periodic timers on a hierarchical timing wheel.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTTIMERWHEEL_H_
+#define _NTTIMERWHEEL_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Condition variables */
+#include <condition_variable>
+/*! \brief  Threads */
+#include <thread>
+/*! \brief  Function wrapper */
+#include <functional>
+/*! \brief  Time durations */
+#include <chrono>
+/*! \brief  Fixed width integers */
+#include <cstdint>
+
+/*! \class      NTTimerWheel
+ *  \brief      Timer service of the frame loop.
+ *  \details    Time is counted in ticks of the resolution. Timers sit in a
+ *              hierarchical timing wheel: 4 levels of 64 slots, the first
+ *              level holds the next 64 ticks one per slot, every next level
+ *              64 times more ticks per slot. A slot is a linked list, so
+ *              adding and cancelling a timer is O(1). When the wheel reaches
+ *              a slot of a higher level, its timers move down to the levels
+ *              below. Timers further than the wheel (about 4.6 hours at 1 ms)
+ *              wait in the last level.
+ *
+ *              advance() runs the callbacks of the timers that are due, on
+ *              the thread that calls it (NTFrameScheduler does it before the
+ *              update of every frame). It jumps over empty slots with the
+ *              occupancy mask of each level, and next() finds the nearest
+ *              deadline the same way, so a loop with many pending timers
+ *              only wakes up for the first one. Callbacks are called without
+ *              the mutex held: they may add and cancel timers. A periodic
+ *              timer late by several periods fires once.
+ *
+ *              Threads: all methods may be called from any thread. Once
+ *              cancel() returns, the callback is not running and is never
+ *              called again, so the destructor of an object whose callback
+ *              the timer calls may cancel it and free the object. The wait
+ *              is skipped for the thread that runs the callback (a callback
+ *              may cancel its own timer) and by cancel(id, false), which a
+ *              caller holding a lock the callback takes must use.
+ */
+class NTTimerWheel
+{
+public:
+	/*!	\brief	Timer handle (0 - none) */
+	typedef uint64_t Id;
+
+	/*! \brief      Constructor
+	 *  \param      resolution  Duration of a tick
+	 */
+	explicit NTTimerWheel(std::chrono::microseconds resolution = std::chrono::milliseconds(1));
+
+	/*! \brief  Destructor */
+	~NTTimerWheel();
+
+	NTTimerWheel(const NTTimerWheel&) = delete;
+	NTTimerWheel& operator=(const NTTimerWheel&) = delete;
+
+	/*! \brief      Adds a one-shot timer
+	 *  \param      delay       Time from now (fires on the first tick after it)
+	 *  \param      callback    Function called once
+	 *  \return     Timer handle
+	 */
+	Id after(std::chrono::microseconds delay, std::function<void()> callback);
+
+	/*! \brief      Adds a periodic timer
+	 *  \param      period      Time between the calls (the first after one period)
+	 *  \param      callback    Function called every period
+	 *  \return     Timer handle
+	 */
+	Id every(std::chrono::microseconds period, std::function<void()> callback);
+
+	/*! \brief      Cancels a timer
+	 *  \details    Waits until a call of the callback running on another
+	 *              thread returns, unless wait is false.
+	 *  \param      id      Timer handle
+	 *  \param      wait    Wait for a running callback (default: true)
+	 *  \return     true if the timer was pending
+	 */
+	bool cancel(Id id, bool wait = true);
+
+	/*! \brief      Checks if a timer is pending
+	 *  \param      id  Timer handle
+	 *  \return     true if the timer will fire
+	 */
+	bool active(Id id) const;
+
+	/*! \brief      Gets the number of pending timers
+	 *  \return     Number of timers
+	 */
+	size_t size() const;
+
+	/*! \brief      Gets the nearest deadline
+	 *  \return     Time of the first timer (time_point::max() if none)
+	 */
+	std::chrono::steady_clock::time_point next() const;
+
+	/*! \brief      Runs the timers that are due
+	 *  \param      now     Current time
+	 *  \return     Number of callbacks called
+	 */
+	size_t advance(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+private:
+	static constexpr int Levels = 4;		/*!< Levels of the wheel */
+	static constexpr int Bits = 6;			/*!< Bits of the slot index */
+	static constexpr int Slots = 1 << Bits;	/*!< Slots of every level */
+
+	/*!	\brief	Timer of the wheel */
+	struct Timer {
+		uint64_t expiry;						/*!< Tick of the next call */
+		uint64_t period;						/*!< Ticks between the calls (0 - one-shot) */
+		std::shared_ptr<std::function<void()>> callback;	/*!< Function to call */
+		uint32_t generation;					/*!< Changes when the entry is reused */
+		int32_t prev;							/*!< Previous timer of the slot (-1 - none) */
+		int32_t next;							/*!< Next timer of the slot (-1 - none) */
+		uint8_t level;							/*!< Level of the slot */
+		uint8_t slot;							/*!< Slot in the level */
+		bool linked;							/*!< Timer is in a slot */
+		bool used;								/*!< Entry holds a pending timer */
+	};
+
+	/*! \brief      Adds a timer
+	 *  \details    Must be called with _mutex held.
+	 *  \param      delay       Time from now
+	 *  \param      period      Ticks between the calls (0 - one-shot)
+	 *  \param      callback    Function to call
+	 *  \return     Timer handle
+	 */
+	Id insert(std::chrono::microseconds delay, uint64_t period, std::function<void()> callback);
+
+	/*! \brief      Finds the entry of a pending timer
+	 *  \details    Must be called with _mutex held.
+	 *  \param      id  Timer handle
+	 *  \return     Index of the entry (-1 - not pending)
+	 */
+	int32_t find(Id id) const;
+
+	/*! \brief      Puts a timer into the slot of its expiry
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Entry of the timer
+	 */
+	void link(int32_t index);
+
+	/*! \brief      Takes a timer out of its slot
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Entry of the timer
+	 */
+	void unlink(int32_t index);
+
+	/*! \brief      Frees the entry of a timer
+	 *  \details    Must be called with _mutex held.
+	 *  \param      index   Entry of the timer
+	 */
+	void release(int32_t index);
+
+	/*! \brief      Takes all timers of a slot
+	 *  \details    Must be called with _mutex held.
+	 *  \param      level   Level of the slot
+	 *  \param      slot    Slot in the level
+	 *  \return     First timer of the list (-1 - none)
+	 */
+	int32_t take(int level, int slot);
+
+	/*! \brief      Gets the first occupied slot of a level after the current tick
+	 *  \details    Must be called with _mutex held.
+	 *  \param      level   Level
+	 *  \param      tick    First tick of the slot
+	 *  \return     Slot (-1 - the level is empty)
+	 */
+	int upcoming(int level, uint64_t &tick) const;
+
+	/*! \brief      Processes the next tick
+	 *  \details    Must be called with _mutex held.
+	 *  \param      target  Tick advance() runs to (periodic timers skip to after it)
+	 *  \param      due     Timers to call
+	 */
+	void tick(uint64_t target, std::vector<Id> &due);
+
+	/*! \brief      Converts a time to ticks
+	 *  \param      time    Time
+	 *  \return     Ticks since the start of the wheel
+	 */
+	uint64_t ticks(std::chrono::steady_clock::time_point time) const;
+
+	mutable std::mutex _mutex;					/*!< Guards the wheel */
+	std::chrono::steady_clock::time_point _start;	/*!< Time of tick 0 */
+	std::chrono::microseconds _resolution;		/*!< Duration of a tick */
+	uint64_t _now;								/*!< Last processed tick */
+	std::vector<Timer> _timers;					/*!< Timer entries */
+	std::vector<int32_t> _free;					/*!< Free entries */
+	int32_t _slots[Levels][Slots];				/*!< First timer of every slot (-1 - empty) */
+	uint64_t _occupied[Levels];					/*!< Non-empty slots of every level */
+	size_t _count;								/*!< Pending timers */
+	std::vector<std::pair<Id, std::thread::id>> _running;	/*!< Callbacks being called and their threads */
+	std::condition_variable _finished;			/*!< Signals that a callback returned */
+};
+
+#endif // _NTTIMERWHEEL_H_
@@ -9,6 +9,8 @@
 #ifndef _NTTYPES_H_
 #define _NTTYPES_H_
 
+/*! \brief  Standard size types */
+#include <cstddef>
 /*!	\brief	Standard string library */
 #include <string>
 /*! \brief  Standard vector library */
@@ -40,6 +42,76 @@ namespace nt {
 		unsigned char blue;   /*!< Blue color component (0-255) */
 	};
 
+	/*!
+	 *  \struct Rect
+	 *  \brief    Structure representing screen area in cells
+	 */
+	struct Rect {
+		int x;			/*!< X coordinate of the left-top corner */
+		int y;			/*!< Y coordinate of the left-top corner */
+		int width;		/*!< Width in columns */
+		int height;		/*!< Height in rows */
+	};
+
+	/*!
+	 *  \struct Size
+	 *  \brief    Structure representing size in cells
+	 */
+	struct Size {
+		int width;		/*!< Width in columns */
+		int height;		/*!< Height in rows */
+	};
+
+	/*! \brief  Checks if the areas are equal */
+	inline bool operator==(const Rect &a, const Rect &b)
+	{
+		return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+	}
+
+	/*! \brief  Checks if the areas differ */
+	inline bool operator!=(const Rect &a, const Rect &b)
+	{
+		return !(a == b);
+	}
+
+	/*! \brief  Checks if the sizes are equal */
+	inline bool operator==(const Size &a, const Size &b)
+	{
+		return a.width == b.width && a.height == b.height;
+	}
+
+	/*! \brief  Checks if the sizes differ */
+	inline bool operator!=(const Size &a, const Size &b)
+	{
+		return !(a == b);
+	}
+
+	/*! \brief      Gets the common part of two areas
+	 *  \return     Common area ({0, 0, 0, 0} if the areas do not overlap)
+	 */
+	inline Rect intersect(const Rect &a, const Rect &b)
+	{
+		int x0 = a.x > b.x ? a.x : b.x, x1 = a.x + a.width < b.x + b.width ? a.x + a.width : b.x + b.width;
+		int y0 = a.y > b.y ? a.y : b.y, y1 = a.y + a.height < b.y + b.height ? a.y + a.height : b.y + b.height;
+		if (x0 >= x1 || y0 >= y1) return {0, 0, 0, 0};
+		return {x0, y0, x1 - x0, y1 - y0};
+	}
+
+	/*! \brief  Checks if the areas have a common cell */
+	inline bool overlaps(const Rect &a, const Rect &b)
+	{
+		return a.x < b.x + b.width && b.x < a.x + a.width &&
+			   a.y < b.y + b.height && b.y < a.y + a.height;
+	}
+
+	/*! \brief  Rounds up to a power of two (ring buffer capacities) */
+	inline size_t powerOfTwo(size_t value)
+	{
+		size_t result = 1;
+		while (result < value) result <<= 1;
+		return result;
+	}
+
 	/*!
 	 *  \struct Image
 	 *  \brief    Structure representing symbol map of the image
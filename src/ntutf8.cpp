@@ -0,0 +1,272 @@
+/*!	\file		ntutf8.cpp
+ *	\brief		Implementation of the UTF-8 text helpers
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntutf8.h"
+
+/*!	\brief	Standard algorithms */
+#include <algorithm>
+/*!	\brief	Standard fixed-size array */
+#include <array>
+/*!	\brief	Standard memory functions */
+#include <cstring>
+/*!	\brief	Standard integer types */
+#include <cstdint>
+
+#ifdef __SSE2__
+/*!	\brief	SSE2 intrinsics */
+#include <emmintrin.h>
+#endif
+
+namespace {
+	/*!	\brief	Inclusive code point range */
+	struct Range {
+		char32_t first;	/*!< First code point */
+		char32_t last;	/*!< Last code point */
+	};
+
+	// East Asian Wide (W) and Fullwidth (F) ranges, including emoji presentation
+	const Range wideRanges[] = {
+		{0x1100, 0x115F}, {0x231A, 0x231B}, {0x2329, 0x232A}, {0x23E9, 0x23EC},
+		{0x23F0, 0x23F0}, {0x23F3, 0x23F3}, {0x25FD, 0x25FE}, {0x2614, 0x2615},
+		{0x2648, 0x2653}, {0x267F, 0x267F}, {0x2693, 0x2693}, {0x26A1, 0x26A1},
+		{0x26AA, 0x26AB}, {0x26BD, 0x26BE}, {0x26C4, 0x26C5}, {0x26CE, 0x26CE},
+		{0x26D4, 0x26D4}, {0x26EA, 0x26EA}, {0x26F2, 0x26F3}, {0x26F5, 0x26F5},
+		{0x26FA, 0x26FA}, {0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B},
+		{0x2728, 0x2728}, {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755},
+		{0x2757, 0x2757}, {0x2795, 0x2797}, {0x27B0, 0x27B0}, {0x27BF, 0x27BF},
+		{0x2B1B, 0x2B1C}, {0x2B50, 0x2B50}, {0x2B55, 0x2B55}, {0x2E80, 0x3029},
+		{0x302E, 0x303E}, {0x3041, 0x3096}, {0x309B, 0x33FF}, {0x3400, 0x4DBF},
+		{0x4E00, 0x9FFF}, {0xA000, 0xA4CF}, {0xA960, 0xA97F}, {0xAC00, 0xD7A3},
+		{0xF900, 0xFAFF}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6F}, {0xFF00, 0xFF60},
+		{0xFFE0, 0xFFE6}, {0x16FE0, 0x16FE4}, {0x17000, 0x18CFF}, {0x1B000, 0x1B2FF},
+		{0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF}, {0x1F18E, 0x1F18E}, {0x1F191, 0x1F19A},
+		{0x1F200, 0x1F202}, {0x1F210, 0x1F23B}, {0x1F240, 0x1F248}, {0x1F250, 0x1F251},
+		{0x1F260, 0x1F265}, {0x1F300, 0x1F320}, {0x1F32D, 0x1F335}, {0x1F337, 0x1F37C},
+		{0x1F37E, 0x1F393}, {0x1F3A0, 0x1F3CA}, {0x1F3CF, 0x1F3D3}, {0x1F3E0, 0x1F3F0},
+		{0x1F3F4, 0x1F3F4}, {0x1F3F8, 0x1F43E}, {0x1F440, 0x1F440}, {0x1F442, 0x1F4FC},
+		{0x1F4FF, 0x1F53D}, {0x1F54B, 0x1F54E}, {0x1F550, 0x1F567}, {0x1F57A, 0x1F57A},
+		{0x1F595, 0x1F596}, {0x1F5A4, 0x1F5A4}, {0x1F5FB, 0x1F64F}, {0x1F680, 0x1F6C5},
+		{0x1F6CC, 0x1F6CC}, {0x1F6D0, 0x1F6D2}, {0x1F6D5, 0x1F6D7}, {0x1F6EB, 0x1F6EC},
+		{0x1F6F4, 0x1F6FC}, {0x1F7E0, 0x1F7EB}, {0x1F90C, 0x1F93A}, {0x1F93C, 0x1F945},
+		{0x1F947, 0x1F9FF}, {0x1FA70, 0x1FAFF}, {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD}
+	};
+
+	// Combining marks and other zero-width code points
+	const Range zeroRanges[] = {
+		{0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05BF},
+		{0x05C1, 0x05C2}, {0x05C4, 0x05C5}, {0x05C7, 0x05C7}, {0x0610, 0x061A},
+		{0x064B, 0x065F}, {0x0670, 0x0670}, {0x06D6, 0x06DC}, {0x06DF, 0x06E4},
+		{0x0900, 0x0902}, {0x093C, 0x093C}, {0x0941, 0x0948}, {0x094D, 0x094D},
+		{0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x1AB0, 0x1AFF},
+		{0x1DC0, 0x1DFF}, {0x200B, 0x200F}, {0x202A, 0x202E}, {0x2060, 0x2064},
+		{0x20D0, 0x20FF}, {0x302A, 0x302D}, {0x3099, 0x309A}, {0xFE00, 0xFE0F},
+		{0xFE20, 0xFE2F}, {0xFEFF, 0xFEFF}, {0xE0001, 0xE0001}, {0xE0020, 0xE007F},
+		{0xE0100, 0xE01EF}
+	};
+
+	constexpr unsigned int BLOCK_SHIFT = 8;				/*!< 256 code points per block */
+	constexpr char32_t TABLE_LIMIT = 0x40000;			/*!< Planes 0-3 are covered by the table */
+	constexpr unsigned char BLOCK_NARROW = 0;			/*!< Every code point in the block is narrow */
+	constexpr unsigned char BLOCK_WIDE = 1;				/*!< Every code point in the block is wide */
+	constexpr unsigned char BLOCK_MIXED = 2;			/*!< Block needs a range search */
+
+	using BlockTable = std::array<unsigned char, (TABLE_LIMIT >> BLOCK_SHIFT)>;
+
+	// Checks if the code point is inside one of the sorted ranges
+	template <size_t N>
+	bool inRanges(const Range (&ranges)[N], char32_t cp)
+	{
+		const Range *end = ranges + N;
+		const Range *it = std::upper_bound(ranges, end, cp,
+			[](char32_t value, const Range &range) { return value < range.first; });
+		return it != ranges && cp <= (it - 1)->last;
+	}
+
+	// Marks the blocks touched by the ranges
+	template <size_t N>
+	void markBlocks(BlockTable &table, const Range (&ranges)[N], bool wide)
+	{
+		for (const Range &range : ranges) {
+			if (range.first >= TABLE_LIMIT) continue;
+			char32_t last = std::min<char32_t>(range.last, TABLE_LIMIT - 1);
+			for (char32_t block = range.first >> BLOCK_SHIFT; block <= (last >> BLOCK_SHIFT); block++) {
+				char32_t bfirst = block << BLOCK_SHIFT;
+				char32_t blast = bfirst + (1u << BLOCK_SHIFT) - 1;
+				bool full = range.first <= bfirst && range.last >= blast;
+				if (wide && full && table[block] == BLOCK_NARROW) {
+					table[block] = BLOCK_WIDE;
+				} else {
+					table[block] = BLOCK_MIXED;
+				}
+			}
+		}
+	}
+
+	// Builds the block classification table (done once)
+	const BlockTable &blockTable()
+	{
+		static const BlockTable table = [] {
+			BlockTable t{};
+			markBlocks(t, wideRanges, true);
+			markBlocks(t, zeroRanges, false);
+			return t;
+		}();
+		return table;
+	}
+}
+
+// Checks that the byte run is pure ASCII
+bool nt::isAscii(const char *data, size_t length)
+{
+	size_t i = 0;
+#ifdef __SSE2__
+	for (; i + 16 <= length; i += 16) {
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+		if (_mm_movemask_epi8(chunk) != 0) return false;
+	}
+#endif
+	for (; i + 8 <= length; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, data + i, sizeof(word));
+		if (word & 0x8080808080808080ULL) return false;
+	}
+	for (; i < length; i++) {
+		if (static_cast<unsigned char>(data[i]) & 0x80) return false;
+	}
+	return true;
+}
+
+// Decodes one UTF-8 sequence
+size_t nt::decode(const char *data, size_t length, char32_t &cp)
+{
+	if (length == 0) {
+		cp = 0;
+		return 0;
+	}
+
+	const unsigned char *s = reinterpret_cast<const unsigned char *>(data);
+	unsigned char lead = s[0];
+	size_t count;
+	char32_t min;
+
+	if (lead < 0x80) {
+		cp = lead;
+		return 1;
+	} else if ((lead & 0xE0) == 0xC0) {
+		count = 2; min = 0x80; cp = lead & 0x1F;
+	} else if ((lead & 0xF0) == 0xE0) {
+		count = 3; min = 0x800; cp = lead & 0x0F;
+	} else if ((lead & 0xF8) == 0xF0) {
+		count = 4; min = 0x10000; cp = lead & 0x07;
+	} else {
+		cp = 0xFFFD;
+		return 1;
+	}
+
+	if (count > length) {
+		cp = 0xFFFD;
+		return 1;
+	}
+
+	for (size_t i = 1; i < count; i++) {
+		if ((s[i] & 0xC0) != 0x80) {
+			cp = 0xFFFD;
+			return 1;
+		}
+		cp = (cp << 6) | (s[i] & 0x3F);
+	}
+
+	// Reject overlong forms, surrogates and out-of-range values
+	if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+		cp = 0xFFFD;
+		return 1;
+	}
+	return count;
+}
+
+// Encodes one code point as UTF-8
+size_t nt::encode(char32_t cp, char *data)
+{
+	if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+
+	unsigned char *s = reinterpret_cast<unsigned char *>(data);
+	if (cp < 0x80) {
+		s[0] = static_cast<unsigned char>(cp);
+		return 1;
+	} else if (cp < 0x800) {
+		s[0] = static_cast<unsigned char>(0xC0 | (cp >> 6));
+		s[1] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+		return 2;
+	} else if (cp < 0x10000) {
+		s[0] = static_cast<unsigned char>(0xE0 | (cp >> 12));
+		s[1] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+		s[2] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+		return 3;
+	}
+	s[0] = static_cast<unsigned char>(0xF0 | (cp >> 18));
+	s[1] = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3F));
+	s[2] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+	s[3] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+// Gets the terminal cell width of the code point
+int nt::charWidth(char32_t cp)
+{
+	if (cp < 0x300) return 1;
+
+	if (cp < TABLE_LIMIT) {
+		unsigned char kind = blockTable()[cp >> BLOCK_SHIFT];
+		if (kind == BLOCK_NARROW) return 1;
+		if (kind == BLOCK_WIDE) return 2;
+	}
+
+	if (inRanges(zeroRanges, cp)) return 0;
+	if (inRanges(wideRanges, cp)) return 2;
+	return 1;
+}
+
+// Rebuilds the column map for the text
+void nt::TextLayout::assign(std::string_view text)
+{
+	map.clear();
+	ascii = isAscii(text.data(), text.size());
+
+	if (ascii) {
+		columns = text.size();
+		return;
+	}
+
+	map.reserve(text.size());
+	size_t offset = 0;
+	while (offset < text.size()) {
+		char32_t cp;
+		size_t length = decode(text.data() + offset, text.size() - offset, cp);
+		int width = charWidth(cp);
+
+		if (width == 0) {
+			// Attach combining marks to the preceding glyph
+			if (!map.empty()) {
+				TextColumn &base = map.back().length ? map.back() : map[map.size() - 2];
+				if (base.length + length <= 0xFF) {
+					base.length += length;
+				}
+				offset += length;
+				continue;
+			}
+			width = 1;
+		}
+
+		map.push_back({static_cast<unsigned int>(offset), static_cast<unsigned char>(length),
+					   static_cast<unsigned char>(width)});
+		if (width == 2) {
+			map.push_back({static_cast<unsigned int>(offset), 0, 0});
+		}
+		offset += length;
+	}
+	columns = map.size();
+}
@@ -0,0 +1,170 @@
+/*!	\file		ntview.cpp
+ *	\brief		Frame stream viewer tool
+ *	\details	Shows an NT frame stream from a Unix domain socket or a pipe on
+ *			the terminal.
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <clocale>
+#include <algorithm>
+
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "nttypes.h"
+#include "ntcursessink.h"
+#include "ntframecodec.h"
+#include "ntstreamsink.h"
+
+// Prints the usage
+static void usage()
+{
+	std::cerr << "Usage: ntview <socket>" << std::endl
+			  << "       ntview -" << std::endl
+			  << "  <socket>  connect to the stream server (see NTStreamServer)" << std::endl
+			  << "  -         read the stream from the standard input" << std::endl
+			  << "Keys: q - quit, r - ask for a whole frame" << std::endl;
+}
+
+// Connects to the stream server
+static int connectTo(const std::string &path)
+{
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path)) return -1;
+	std::memcpy(address.sun_path, path.c_str(), path.size());
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) return -1;
+	if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2) {
+		usage();
+		return EXIT_FAILURE;
+	}
+	std::string source = argv[1];
+	bool socket = source != "-";
+	int fd = socket ? connectTo(source) : STDIN_FILENO;
+	if (fd < 0) {
+		std::cerr << source << ": can not connect" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// The first frame of a socket stream is whole; asking makes no difference for a new viewer
+	char request = nt::STREAM_KEYFRAME;
+	if (socket && send(fd, &request, 1, MSG_NOSIGNAL) != 1) {
+		std::cerr << source << ": can not connect" << std::endl;
+		close(fd);
+		return EXIT_FAILURE;
+	}
+
+	// Keys come from the terminal, the stream may be on the standard input
+	setlocale(LC_ALL, "");
+	FILE *keyboard = socket ? stdin : std::fopen("/dev/tty", "r");
+	SCREEN *screen = keyboard ? newterm(nullptr, stdout, keyboard) : nullptr;
+	if (!screen) {
+		std::cerr << "Can not open the terminal" << std::endl;
+		if (keyboard && !socket) std::fclose(keyboard);
+		if (socket) close(fd);
+		return EXIT_FAILURE;
+	}
+	set_term(screen);
+	cbreak();
+	noecho();
+	curs_set(0);
+	timeout(0);
+	if (has_colors()) {
+		start_color();
+		use_default_colors();
+	}
+
+	NTCursesSink sink;
+	NTFrameCodec codec;
+	std::string data;
+	size_t frames = 0, bytes = 0;
+	bool header = false;
+	std::string error;
+
+	for (;;) {
+		struct pollfd fds[2] = {{fd, POLLIN, 0}, {fileno(keyboard), POLLIN, 0}};
+		if (poll(fds, 2, -1) < 0 && errno != EINTR) break;
+
+		// Keys
+		int ch;
+		bool quit = false;
+		while ((ch = getch()) != ERR) {
+			if (ch == 'q') quit = true;
+			if (ch == 'r' && socket) {
+				if (send(fd, &request, 1, MSG_NOSIGNAL) == 1) sink.invalidate();
+			}
+			if (ch == KEY_RESIZE && header) sink.present(codec.frame());
+		}
+		if (quit) break;
+		if (!(fds[0].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+		char buffer[65536];
+		ssize_t count = read(fd, buffer, sizeof(buffer));
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) break;	// the stream ended
+		data.append(buffer, static_cast<size_t>(count));
+		bytes += static_cast<size_t>(count);
+
+		// The magic, then all the complete records; the frame is shown once per read
+		size_t used = 0;
+		if (!header) {
+			size_t size = sizeof(nt::STREAM_MAGIC) + 1;
+			if (data.size() < size) continue;
+			if (!std::equal(std::begin(nt::STREAM_MAGIC), std::end(nt::STREAM_MAGIC), data.begin()) ||
+				static_cast<unsigned char>(data[size - 1]) != nt::STREAM_VERSION) {
+				error = "not a frame stream";
+				break;
+			}
+			header = true;
+			used = size;
+		}
+		bool changed = false;
+		for (;;) {
+			long size = codec.decode(data.data() + used, data.size() - used);
+			if (size == 0) break;
+			if (size < 0) {
+				error = "stream is not valid";
+				break;
+			}
+			used += static_cast<size_t>(size);
+			for (const NTFrameCodec::Pair &pair : codec.pairs()) sink.define(pair.pair, pair.foreground, pair.background);
+			changed = true;
+			frames++;
+		}
+		data.erase(0, used);
+		if (!error.empty()) break;
+		if (changed) sink.present(codec.frame());
+	}
+
+	endwin();
+	delscreen(screen);
+	if (!socket) std::fclose(keyboard);
+	if (socket) close(fd);
+	std::cout << frames << " frames, " << bytes << " bytes" << std::endl;
+	if (!error.empty()) {
+		std::cerr << source << ": " << error << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/*!	\file		ntwidgetarena.cpp
+ *	\brief		Implementation of the NTWidgetArena class
+ *	\details	Contains method implementations for per-screen widget arenas in the NT system
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include "ntwidgetarena.h"
+
+namespace {
+	const size_t largestPooled = 64 * 1024;	// larger blocks are not reused before clear()
+}
+
+// Constructor
+NTWidgetArena::NTWidgetArena(size_t capacity)
+	: _buffer(new std::byte[capacity]),
+	_blocks(_buffer.get(), capacity),
+	_pools({0, largestPooled}, &_blocks)
+{
+}
+
+// Destructor
+NTWidgetArena::~NTWidgetArena()
+{
+	clear();
+}
+
+// Gets the widgets
+const std::vector<NTGraphicObject *> &NTWidgetArena::widgets() const
+{
+	return _widgets;
+}
+
+// Gets the number of widgets
+size_t NTWidgetArena::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _widgets.size();
+}
+
+// Destroys all widgets and releases the memory in bulk
+void NTWidgetArena::clear()
+{
+	std::vector<NTGraphicObject *> widgets;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		widgets.swap(_widgets);
+	}
+
+	// Destructors give their strings back to the arena, so the lock is not held here
+	for (auto it = widgets.rbegin(); it != widgets.rend(); ++it) {
+		(*it)->~NTGraphicObject();
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pools.release();
+	_blocks.release();
+}
+
+// Allocates from the pools (new memory from the current block)
+void *NTWidgetArena::do_allocate(size_t bytes, size_t alignment)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pools.allocate(bytes, alignment);
+}
+
+// Gives the memory back to its pool; blocks are released in bulk by clear()
+void NTWidgetArena::do_deallocate(void *p, size_t bytes, size_t alignment)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pools.deallocate(p, bytes, alignment);
+}
+
+// Only the arena itself can free its memory
+bool NTWidgetArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+// Registers a widget for destruction
+void NTWidgetArena::adopt(NTGraphicObject *widget)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_widgets.push_back(widget);
+}
@@ -0,0 +1,122 @@
+/*! \file       ntwidgetarena.h
+ *  \brief      NT Widget arena module (header file).
+ *  \details    Contains the NTWidgetArena class definitions: per-screen
+ *              memory for widgets, their names and text, released in bulk.
+ *  \author     Arthur Markaryan
+ *  \date       19.10.2026
+ *  \copyright  Arthur Markaryan
+ */
+
+#ifndef _NTWIDGETARENA_H_
+#define _NTWIDGETARENA_H_
+
+/*! \brief  Standard vector library */
+#include <vector>
+/*! \brief  Smart pointers */
+#include <memory>
+/*! \brief  Polymorphic memory resources */
+#include <memory_resource>
+/*! \brief  Standard utilities */
+#include <utility>
+/*! \brief  Mutex library */
+#include <mutex>
+/*! \brief  Type traits */
+#include <type_traits>
+
+/*! \brief  Base NT graphic object */
+#include "ntgraphicobject.h"
+
+/*! \class      NTWidgetArena
+ *  \brief      Per-screen widget arena.
+ *  \details    Widgets created by the arena live in a few large blocks
+ *              together with their names and text (std::pmr strings of the
+ *              widgets allocate from the arena). clear() destroys all widgets
+ *              in reverse order and rewinds the arena to its first block, so
+ *              rebuilding a screen on navigation reuses the same memory.
+ *
+ *              Image payloads are not copied into the arena: they are shared
+ *              NTImageData (see NTImageData::intern), so equal images of all
+ *              screens already have one copy.
+ *
+ *              The arena is thread-safe, so widgets may change their text from
+ *              any thread. Memory freed by a widget (e.g. old text) goes to
+ *              pools by size and is reused by the next allocations, so a label
+ *              whose text changes every frame does not grow the arena (blocks
+ *              over 64 KiB are only reused after clear()). Copies
+ *              of arena widgets are allocated on the heap and may outlive the
+ *              arena.
+ *  \extends    std::pmr::memory_resource
+ */
+class NTWidgetArena : public std::pmr::memory_resource
+{
+public:
+	/*! \brief      Constructor
+	 *  \param      capacity    Size of the first block in bytes (kept between clear() calls)
+	 */
+	explicit NTWidgetArena(size_t capacity = 64 * 1024);
+
+	/*! \brief  Destructor (destroys all widgets) */
+	~NTWidgetArena();
+
+	NTWidgetArena(const NTWidgetArena&) = delete;
+	NTWidgetArena& operator=(const NTWidgetArena&) = delete;
+
+	/*! \brief      Creates a widget in the arena
+	 *  \details    The arguments are passed to the constructor of the widget,
+	 *              followed by the arena as its memory resource if the
+	 *              constructor takes one, e.g.
+	 *              create<NTLabel>(parent, name, text, x, y, colorPair, attr, ntattr).
+	 *              A widget built without the resource (create<NTLabel>(parent, name))
+	 *              lives in the arena but keeps its strings on the heap.
+	 *  \return     Pointer to the widget, owned by the arena
+	 */
+	template <class T, class... Args>
+	T *create(Args&&... args)
+	{
+		static_assert(std::is_base_of<NTGraphicObject, T>::value, "T must be an NTGraphicObject");
+		void *memory = allocate(sizeof(T), alignof(T));
+		T *widget;
+		if constexpr (std::is_constructible<T, Args&&..., std::pmr::memory_resource *>::value) {
+			widget = new (memory) T(std::forward<Args>(args)..., static_cast<std::pmr::memory_resource *>(this));
+		} else {
+			widget = new (memory) T(std::forward<Args>(args)...);
+		}
+		adopt(widget);
+		return widget;
+	}
+
+	/*! \brief      Gets the widgets
+	 *  \details    Only for use from the thread that creates the widgets.
+	 *  \return     Widgets in creation order
+	 */
+	const std::vector<NTGraphicObject *> &widgets() const;
+
+	/*! \brief      Gets the number of widgets
+	 *  \return     Number of widgets
+	 */
+	size_t size() const;
+
+	/*! \brief      Destroys all widgets and releases the memory in bulk
+	 *  \details    Pointers to the widgets become invalid.
+	 */
+	void clear();
+
+protected:
+	void *do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+private:
+	/*! \brief      Registers a widget for destruction
+	 *  \param      widget  Widget created in the arena
+	 */
+	void adopt(NTGraphicObject *widget);
+
+	mutable std::mutex _mutex;					/*!< Guards the blocks and the widget list */
+	std::unique_ptr<std::byte[]> _buffer;		/*!< First block */
+	std::pmr::monotonic_buffer_resource _blocks;	/*!< Bump allocator over the blocks */
+	std::pmr::unsynchronized_pool_resource _pools;	/*!< Freed memory by size, over the blocks */
+	std::vector<NTGraphicObject *> _widgets;	/*!< Widgets in creation order */
+};
+
+#endif // _NTWIDGETARENA_H_
@@ -2,12 +2,22 @@
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <clocale>
+#include <unistd.h>
 
 #include "nttypes.h"
 #include "ntobject.h"
 //#include "ntpalette.h"
 #include "ntlabel.h"
 #include "ntimage.h"
+#include "ntanimatedimage.h"
+#include "ntscreen.h"
+#include "ntframescheduler.h"
+#include "nttimerwheel.h"
+#include "ntanimator.h"
+#include "ntframerecorder.h"
+#include "ntstreamserver.h"
+#include "ntcursessink.h"
 #include "digits_8x8.h"
 #include "digits_16x16.h"
 
@@ -26,6 +36,25 @@ int main(int argc, char* argv[])
 // Test Color
 //	NTColor Color1;
 // ncurses init
+	setlocale(LC_ALL, "");	// UTF-8 text needs the locale set before initscr()
+
+	// Mirror of the screen on another terminal (-m <tty>), opened before the main one
+	FILE *MirrorTty = nullptr;
+	SCREEN *MirrorTerminal = nullptr;
+	for (int i = 1; i + 1 < argc && !MirrorTerminal; i++) {
+		if (std::string(argv[i]) != "-m") continue;
+		MirrorTty = fopen(argv[i + 1], "r+");
+		MirrorTerminal = MirrorTty ? newterm(nullptr, MirrorTty, MirrorTty) : nullptr;
+		if (!MirrorTerminal) {
+			fprintf(stderr, "Can not open %s\n", argv[i + 1]);
+			return EXIT_FAILURE;
+		}
+		curs_set(0);
+		if (has_colors()) {
+			start_color();
+			use_default_colors();
+		}
+	}
 	initscr();
 	cbreak();
 	noecho();
@@ -41,18 +70,40 @@ int main(int argc, char* argv[])
 	}
 
 	start_color();
-	printw("0________________________________\n");
-	printw("1________________________________\n");
-	printw("2________________________________\n");
-	printw("3________________________________\n");
-	printw("4________________________________\n");
-	printw("5________________________________\n");
-	printw("6________________________________\n");
-	printw("7______________________________________________________________________________________\n");
-	printw("Color pair max count: %d\n", COLOR_PAIRS);
 	use_default_colors();
 
+	// Recording of the frames (-r <file>), played back by ntreplay,
+	// and the stream of the frames (-s <socket>), shown by ntview
+	NTFrameRecorder Recorder;
+	NTStreamServer Server;
+	bool recorded = false, streamed = false;
+	for (int i = 1; i + 1 < argc; i++) {
+		std::string arg = argv[i];
+		if ((arg == "-r" && Recorder.open(argv[i + 1]) != NT_OK) || (arg == "-s" && Server.listen(argv[i + 1]) != NT_OK)) {
+			endwin();
+			fprintf(stderr, "Can not create %s\n", argv[i + 1]);
+			return EXIT_FAILURE;
+		}
+		recorded = recorded || arg == "-r";
+		streamed = streamed || arg == "-s";
+	}
+	NTCursesSink Mirror(nullptr, MirrorTerminal, MirrorTty ? fileno(MirrorTty) : -1);
+
 // User render
+	// Timers of the widgets (declared first: widgets cancel their timers when destroyed)
+	NTTimerWheel Timers;
+
+	// Background lines under the labels
+	std::vector<std::string> lines;
+	for (int i = 0; i < 7; i++) lines.push_back(std::to_string(i) + std::string(32, '_'));
+	lines.push_back("7" + std::string(86, '_'));
+	lines.push_back("Color pair max count: " + std::to_string(COLOR_PAIRS));
+	std::vector<NTLabel> Background;
+	Background.reserve(lines.size());
+	for (size_t i = 0; i < lines.size(); i++) {
+		Background.emplace_back(nullptr, "Background" + std::to_string(i), lines[i], 0, static_cast<int>(i), 0, 0, NTA_NONE);
+	}
+
 	// Colors
 	unsigned char color_time_id = 0;
 	nt::Color color_Time = nt::Color({255, 0, 0});
@@ -97,13 +148,47 @@ int main(int argc, char* argv[])
 
 	NTLabel Label_Hello(0, "Label_Hello");
 
+	NTLabel Label_Utf8(0, "Label_Utf8", "Привет, 世界!", 40, 10, color_pair_Weather, 0, NTA_TEXT_ATTR);
+
 	NTImage Image1(0, "hh_hi", digits_8x8[0], 4, 4, 0, 0, NTA_TEXT_ATTR | NTA_SPACE_TRANSPARENT);
 	NTImage Image2(0, "hh_lo", digits_8x8[0], 3, 3, color_pair_Weather, 0, NTA_TEXT_ATTR | NTA_SPACE_TRANSPARENT);
 
-// Exit programm
-
-	while(ch != ' '){
-
+	// Spinner: all frames live in one shared sprite sheet
+	auto spinner_sheet = std::make_shared<const NTSpriteSheet>(std::vector<nt::Image>{
+		{{"|"}, 1, 1}, {{"/"}, 1, 1}, {{"-"}, 1, 1}, {{"\\"}, 1, 1}
+	}, 200);
+	NTAnimatedImage Spinner(0, "Spinner", spinner_sheet, 24, 10, color_pair_Weather, 0, NTA_TEXT_ATTR);
+	Spinner.setTimers(&Timers);
+	Spinner.play();
+
+	// Screen: background first, the clock is critical, the spinner may wait
+	NTScreen Screen;
+	for (NTLabel &Line : Background) Screen.add(&Line);
+	for (NTGraphicObject *Object : std::initializer_list<NTGraphicObject *>{&Label_Hello,
+			&Label0, &Label1, &Label2, &Label3, &Label4, &Label5, &Label6, &Label7,
+			&Image1, &Image2, &Label_Time, &Label_Utf8, &Spinner}) {
+		Screen.add(Object);
+	}
+	Screen.setPriority(&Label_Time, NTP_CRITICAL);
+	Screen.setPriority(&Spinner, NTP_BACKGROUND);
+
+	// Mirrors: drawn once, every output takes its own changes
+	if (recorded) Screen.attach(&Recorder);
+	if (streamed) Screen.attach(&Server);
+	if (MirrorTerminal) Screen.attach(&Mirror);
+
+	// Tweens: the UTF-8 label slides in
+	NTAnimator Animator;
+	Label_Utf8.setx(60);
+	Animator.tween(&Label_Utf8, NTT_X, 40, std::chrono::milliseconds(800), NTE_OUT);
+
+	NTFrameScheduler Scheduler(&Screen, std::chrono::milliseconds(33));
+	Scheduler.setInput(STDIN_FILENO);
+	Scheduler.setTimers(&Timers);
+	Scheduler.setAnimator(&Animator);
+
+	// Clock: refreshed by a timer, not by every frame
+	Timers.every(std::chrono::milliseconds(200), [&]() {
 		{
 			std::lock_guard<std::mutex> lock(localtime_mutex);
 
@@ -123,32 +208,25 @@ int main(int argc, char* argv[])
 				<< std::setw(2) << std::setfill('0') << _sec;
 			std::string timeString = oss.str();
 			Label_Time.setText(timeString);
+	});
 
-			// Check if neet to redraw
-			if(Label_Hello.isChanged())Label_Hello.draw();
-
-			if(Label0.isChanged())Label0.draw();
-			if(Label1.isChanged())Label1.draw();
-			if(Label2.isChanged())Label2.draw();
-			if(Label3.isChanged())Label3.draw();
-			if(Label4.isChanged())Label4.draw();
-			if(Label5.isChanged())Label5.draw();
-			if(Label6.isChanged())Label6.draw();
-			if(Label7.isChanged())Label7.draw();
-
-			//
-			if(Image1.isChanged())Image1.draw();
-			if(Image2.isChanged())Image2.draw();
-
-			if(Label_Time.isChanged())Label_Time.draw();
-
+	Scheduler.setUpdate([&]() {
 			// Is the Deadlock possible?
 			ch = getch();
+	});
 
+// Exit programm
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	while(ch != ' '){
+		// Redraws only what changed, at a rate that fits the frame budget
+		Scheduler.frame();
 	}
 	endwin();
+	if (MirrorTerminal) {
+		set_term(MirrorTerminal);
+		endwin();
+		fclose(MirrorTty);
+	}
 
 	std::cout << "Program finished." << std::endl;
 	return EXIT_SUCCESS;
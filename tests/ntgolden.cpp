@@ -0,0 +1,602 @@
+/*!	\file		ntgolden.cpp
+ *	\brief		Golden frame tests
+ *	\details	Draws test scenes on a headless terminal with both compositors,
+ *			compares the frames with the stored golden frames and checks the
+ *			cells and bytes every frame writes. A smaller terminal mirrors
+ *			every frame and must show its clipped part.
+ *	\author		Arthur Markaryan
+ *	\date		19.10.2026
+ *	\copyright	Arthur Markaryan
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <clocale>
+#include <cwchar>
+
+#include "nttypes.h"
+#include "ntlabel.h"
+#include "ntanimatedimage.h"
+#include "ntspritesheet.h"
+#include "ntimage.h"
+#include "ntimagedata.h"
+#include "ntscreen.h"
+#include "nttilerenderer.h"
+#include "ntframebuffer.h"
+#include "ntcursessink.h"
+#include "ntwidgetarena.h"
+#include "ntcellstore.h"
+#include "ntscrollview.h"
+#include "nttable.h"
+#include "ntlogview.h"
+#include "ntsparkline.h"
+#include "ntpanel.h"
+#include "nttaskpool.h"
+#include "ntutf8.h"
+
+// Headless terminal size
+static const int screenWidth = 40;
+static const int screenHeight = 12;
+
+// Size of the mirror terminal
+static const int mirrorWidth = 30;
+static const int mirrorHeight = 8;
+
+/*!	\brief	Limits of a frame
+ *	\details	Cells are exact (the tile renderer writes only the changed cells);
+ *			bytes depend on the ncurses version and leave some room.
+ */
+struct Limits {
+	size_t cells;	/*!< Cells written by the tile renderer */
+	long bytes;		/*!< Bytes sent to the terminal by either compositor */
+};
+
+/*!	\brief	Test scene */
+struct Scene {
+	NTWidgetArena arena;									/*!< Memory of the arena widgets */
+	std::vector<std::unique_ptr<NTGraphicObject>> owned;	/*!< Widgets on the heap */
+	std::vector<NTGraphicObject *> objects;				/*!< Widgets from the bottom to the top */
+	std::vector<std::function<void()>> changes;			/*!< Changes before every frame after the first */
+	std::vector<Limits> limits;							/*!< Limits of every frame */
+	std::unique_ptr<NTTaskPool> pool;						/*!< Pool whose results are applied before every frame */
+};
+
+/*!	\brief	Scene builder */
+struct SceneType {
+	const char *name;					/*!< Name (and golden file) */
+	std::function<void(Scene &)> build;	/*!< Creates the widgets */
+};
+
+// Adds a label to a scene
+static NTLabel *label(Scene &scene, const std::string &text, int x, int y, unsigned char pair, chtype attr, unsigned char ntattr)
+{
+	auto object = std::make_unique<NTLabel>(nullptr, "", text, x, y, pair, attr, ntattr);
+	NTLabel *result = object.get();
+	scene.objects.push_back(result);
+	scene.owned.push_back(std::move(object));
+	return result;
+}
+
+// Adds an image to a scene
+static NTImage *image(Scene &scene, const std::vector<std::string> &rows, int x, int y, unsigned char pair, unsigned char ntattr)
+{
+	unsigned int width = 0;
+	for (const std::string &row : rows) {
+		nt::TextLayout layout;
+		layout.assign(row);
+		width = std::max(width, layout.columns);
+	}
+	nt::Image data = {rows, width, static_cast<unsigned int>(rows.size())};
+	auto object = std::make_unique<NTImage>(nullptr, "", data, x, y, pair, A_NORMAL, ntattr);
+	NTImage *result = object.get();
+	scene.objects.push_back(result);
+	scene.owned.push_back(std::move(object));
+	return result;
+}
+
+// Labels with every NTA_* combination over a background
+static void labels(Scene &scene)
+{
+	for (int y = 0; y < 8; y++) label(scene, std::string(screenWidth, '.'), 0, y, 2, A_DIM, NTA_NONE);
+	std::vector<NTLabel *> top;
+	for (int flags = 0; flags < 8; flags++) {
+		top.push_back(label(scene, " nt" + std::to_string(flags) + "  x  y ", 2, flags, 1, A_BOLD, static_cast<unsigned char>(flags)));
+	}
+	label(scene, "wide 世界 text", 2, 9, 3, A_UNDERLINE, NTA_TEXT_ATTR | NTA_SPACE_ATTR);
+
+	scene.changes.push_back([top]() {
+		top[3]->setText(" changed ");
+		top[5]->setText("5");
+	});
+	scene.changes.push_back([]() {});
+	scene.limits = {{screenWidth * screenHeight, 1040}, {15, 110}, {0, 0}};
+}
+
+// Images clipped by every edge of the screen
+static void clipped(Scene &scene)
+{
+	std::vector<std::string> box = {"+---+", "|a b|", "+---+"};
+	NTImage *corner = image(scene, box, -2, -1, 1, NTA_NONE);
+	image(scene, box, screenWidth - 3, screenHeight - 2, 2, NTA_NONE);
+	image(scene, box, screenWidth - 2, -2, 3, NTA_SPACE_TRANSPARENT);
+	image(scene, box, -10, 5, 1, NTA_NONE);
+	image(scene, box, 12, screenHeight + 1, 1, NTA_NONE);
+	image(scene, {"世界世界", "界 世 "}, -1, 6, 2, NTA_NONE);
+	image(scene, {"世界世界"}, screenWidth - 5, 8, 3, NTA_NONE);
+
+	scene.changes.push_back([corner]() { corner->setPosition(10, 3); });
+	scene.changes.push_back([corner]() { corner->setPosition(-6, 3); });
+	scene.limits = {{screenWidth * screenHeight, 110}, {19, 75}, {14, 40}};
+}
+
+// Transparent widgets over opaque ones
+static void overlap(Scene &scene)
+{
+	NTLabel *bottom = label(scene, "AAAAAAAAAAAAAAAA", 2, 2, 1, A_NORMAL, NTA_NONE);
+	label(scene, "B  B  B", 4, 2, 2, A_BOLD, NTA_SPACE_TRANSPARENT);
+	label(scene, "C  C", 8, 2, 3, A_REVERSE, NTA_SPACE_TRANSPARENT | NTA_TEXT_ATTR);
+	image(scene, {"#######", "#     #", "#######"}, 1, 4, 1, NTA_NONE);
+	image(scene, {" ** ", "*  *", " ** "}, 3, 4, 2, NTA_SPACE_TRANSPARENT);
+	label(scene, "世界世界世界", 2, 8, 3, A_NORMAL, NTA_NONE);
+	label(scene, "x", 5, 8, 1, A_NORMAL, NTA_NONE);
+	label(scene, "  ", 9, 8, 2, A_NORMAL, NTA_SPACE_TRANSPARENT);
+
+	scene.changes.push_back([bottom]() { bottom->setText("aaaaaaaaaaaaaaaa"); });
+	scene.changes.push_back([bottom]() { bottom->setPosition(2, 3); });
+	scene.limits = {{screenWidth * screenHeight, 200}, {11, 120}, {27, 105}};
+}
+
+// Stock widgets created in an arena, with and without its memory
+static void arena(Scene &scene)
+{
+	NTLabel *plain = scene.arena.create<NTLabel>(nullptr, "plain");
+	plain->setText("heap text");
+	plain->setPosition(1, 1);
+	NTLabel *counter = scene.arena.create<NTLabel>(nullptr, "counter", "count 0", 1, 3, 1, A_BOLD, NTA_NONE);
+	scene.objects = {plain, counter};
+
+	// Text freed by the label is reused by the arena
+	scene.changes.push_back([counter]() {
+		for (int i = 1; i <= 1000; i++) counter->setText("count " + std::to_string(i) + std::string(40, '.'));
+	});
+	scene.changes.push_back([plain]() { plain->setPosition(3, 1); });
+	scene.limits = {{screenWidth * screenHeight, 45}, {33, 60}, {11, 25}};
+}
+
+// Cells of a store that move, get shorter, stay and move with the store
+static void cells(Scene &scene)
+{
+	auto store = std::make_unique<NTCellStore>(nullptr, "cells", 2, 1);
+	NTCellStore *cells = store.get();
+	scene.objects.push_back(cells);
+	scene.owned.push_back(std::move(store));
+	NTCellStore::Cell moving = cells->add(0, 0, "moving", 1, A_NORMAL, NTA_SPACE_TRANSPARENT);
+	NTCellStore::Cell shrinking = cells->add(0, 2, "long text", 2, A_NORMAL, NTA_SPACE_TRANSPARENT);
+	cells->add(10, 4, "wide 世界", 3, A_NORMAL, NTA_NONE);
+	cells->add(0, 1, "stay", 3, A_NORMAL, NTA_NONE);
+
+	scene.changes.push_back([moving, shrinking]() mutable {
+		moving.setPosition(4, 1);
+		shrinking.setText("short");
+	});
+	scene.changes.push_back([cells]() { cells->setPosition(5, 3); });
+	scene.limits = {{screenWidth * screenHeight, 65}, {21, 50}, {55, 75}};
+}
+
+// Images drawn from sources, loaded on their first draw
+static void lazy(Scene &scene)
+{
+	std::shared_ptr<NTImageSource> source = NTImageData::intern({{"XYZ", "XYZ"}, 3, 2});
+	auto object = std::make_unique<NTImage>(nullptr, "lazy", source, 2, 1, 1, A_NORMAL, NTA_NONE);
+	NTImage *image = object.get();
+	scene.objects.push_back(image);
+	scene.owned.push_back(std::move(object));
+
+	scene.changes.push_back([image]() { image->setSource(NTImageData::intern({{"12345", "12345", "12345"}, 5, 3})); });
+	scene.changes.push_back([image]() { image->setImage({{"ab"}, 2, 1}); });
+	scene.limits = {{screenWidth * screenHeight, 35}, {15, 45}, {15, 30}};
+}
+
+// Children of a scroll view that change, stay, change around another one and scroll
+static void scrolled(Scene &scene)
+{
+	auto view = std::make_unique<NTScrollView>(nullptr, "scroll", 2, 1, 20, 4);
+	NTScrollView *viewport = view.get();
+	scene.objects.push_back(viewport);
+	scene.owned.push_back(std::move(view));
+	std::vector<NTLabel *> rows;
+	for (int y = 0; y < 8; y++) {
+		auto row = std::make_unique<NTLabel>(nullptr, "", "row " + std::to_string(y), 0, 0, 1 + y % 3, A_NORMAL, NTA_NONE);
+		rows.push_back(row.get());
+		viewport->add(row.get(), y % 2, y);
+		scene.owned.push_back(std::move(row));
+	}
+
+	scene.changes.push_back([rows]() { rows[1]->setText("changed 1"); });
+	scene.changes.push_back([]() {});
+	scene.changes.push_back([rows]() {
+		rows[0]->setText("changed 0");
+		rows[2]->setText("changed 2");
+	});
+	scene.changes.push_back([viewport]() { viewport->scrollBy(1); });
+	scene.limits = {{screenWidth * screenHeight, 65}, {8, 20}, {0, 0}, {20, 40}, {42, 45}};
+}
+
+// Labels filled by tasks, applied before the frame
+static void tasks(Scene &scene)
+{
+	scene.pool = std::make_unique<NTTaskPool>(2);
+	NTTaskPool *pool = scene.pool.get();
+	NTLabel *first = label(scene, "waiting", 1, 1, 1, A_NORMAL, NTA_NONE);
+	NTLabel *second = label(scene, "waiting", 1, 3, 2, A_NORMAL, NTA_NONE);
+
+	// Of the results of one key only the newest is shown
+	scene.changes.push_back([pool, first, second]() {
+		for (int i = 1; i <= 50; i++) {
+			pool->schedule(first, [i]() { return "result " + std::to_string(i); },
+						   [first](std::string &text) { first->setText(text); });
+		}
+		pool->schedule(second, []() { return 6 * 7; },
+					   [second](int &value) { second->setText(std::to_string(value)); });
+		pool->wait();
+	});
+	scene.limits = {{screenWidth * screenHeight, 45}, {16, 40}};
+}
+
+// Frames of an animation that differ in a few cells of a row
+static void animated(Scene &scene)
+{
+	auto sheet = std::make_shared<const NTSpriteSheet>(std::vector<nt::Image>{
+		{{"ABCDEF", "GHIJKL"}, 6, 2},
+		{{"AxCDyF", "GHIJKL"}, 6, 2},
+	});
+	auto object = std::make_unique<NTAnimatedImage>(nullptr, "animated", sheet, 3, 2, 1, A_NORMAL, NTA_NONE);
+	NTAnimatedImage *image = object.get();
+	scene.objects.push_back(image);
+	scene.owned.push_back(std::move(object));
+
+	scene.changes.push_back([image]() { image->setFrame(1); });
+	scene.changes.push_back([image]() { image->setFrame(0); });
+	scene.limits = {{screenWidth * screenHeight, 40}, {2, 15}, {2, 12}};
+}
+
+/*!	\brief	Table source of fixed rows */
+struct Rows : NTTableSource {
+	std::vector<std::vector<std::string>> cells;	/*!< Text of every row */
+
+	size_t rows() const override { return cells.size(); }
+	std::string cell(size_t row, unsigned int column) const override { return cells[row][column]; }
+};
+
+// Rows of a table that change around a row that stays
+static void table(Scene &scene)
+{
+	auto rows = std::make_shared<Rows>();
+	rows->cells = {{"one", "1"}, {"two", "2"}, {"three", "3"}, {"four", "4"}};
+	auto object = std::make_unique<NTTable>(nullptr, "table", 2, 1, 5, rows.get());
+	NTTable *table = object.get();
+	table->addColumn("name", 6);
+	table->addColumn("n", 3);
+	scene.objects.push_back(table);
+	scene.owned.push_back(std::move(object));
+
+	// The source outlives the table in the changes
+	scene.changes.push_back([rows, table]() {
+		rows->cells[0][1] = "10";
+		rows->cells[2][0] = "3rd";
+		table->rowsChanged(0);
+		table->rowsChanged(2);
+	});
+	scene.limits = {{screenWidth * screenHeight, 95}, {8, 30}};
+}
+
+// Lines of a log that arrive, and a view that scrolls and resumes in place
+static void logged(Scene &scene)
+{
+	auto object = std::make_unique<NTLogView>(nullptr, "log", 2, 1, 12, 3, 16);
+	NTLogView *log = object.get();
+	scene.objects.push_back(log);
+	scene.owned.push_back(std::move(object));
+	for (int i = 0; i < 4; i++) log->append("line " + std::to_string(i));
+
+	scene.changes.push_back([log]() { log->append("line 4"); });
+	scene.changes.push_back([log]() {
+		log->pause();
+		log->scrollBy(1);
+	});
+	scene.changes.push_back([log]() { log->resume(); });
+	scene.limits = {{screenWidth * screenHeight, 55}, {4, 30}, {0, 15}, {0, 15}};
+}
+
+// Graph of samples where one new sample changes one column
+static void sparkline(Scene &scene)
+{
+	auto object = std::make_unique<NTSparkline>(nullptr, "graph", 2, 1, 8, 2, 16);
+	NTSparkline *graph = object.get();
+	graph->setSamplesPerBucket(1);
+	graph->setRange(0.0f, 8.0f);
+	scene.objects.push_back(graph);
+	scene.owned.push_back(std::move(object));
+	for (int i = 0; i < 6; i++) graph->push(4.0f);
+
+	scene.changes.push_back([graph]() { graph->push(4.0f); });
+	scene.changes.push_back([graph]() { graph->push(8.0f); });
+	scene.limits = {{screenWidth * screenHeight, 40}, {2, 15}, {3, 28}};
+}
+
+// Panel whose children change, over a label, then moved
+static void panel(Scene &scene)
+{
+	label(scene, std::string(screenWidth, '.'), 0, 3, 2, A_DIM, NTA_NONE);
+	auto object = std::make_unique<NTPanel>(nullptr, "panel", 2, 2, 12, 3);
+	NTPanel *panel = object.get();
+	scene.objects.push_back(panel);
+	scene.owned.push_back(std::move(object));
+	std::vector<NTLabel *> children;
+	for (int y = 0; y < 3; y++) {
+		auto child = std::make_unique<NTLabel>(nullptr, "", "child " + std::to_string(y), y, y, 1 + y, A_NORMAL, NTA_NONE);
+		children.push_back(child.get());
+		panel->add(child.get());
+		scene.owned.push_back(std::move(child));
+	}
+	auto wide = std::make_unique<NTLabel>(nullptr, "", "世界", 8, 0, 3, A_BOLD, NTA_NONE);
+	panel->add(wide.get());
+	scene.owned.push_back(std::move(wide));
+
+	scene.changes.push_back([children]() { children[1]->setText("changed"); });
+	scene.changes.push_back([panel]() { panel->setPosition(5, 6); });
+	scene.limits = {{screenWidth * screenHeight, 110}, {7, 20}, {62, 105}};
+}
+
+static const SceneType scenes[] = {
+	{"labels", labels},
+	{"clipped", clipped},
+	{"overlap", overlap},
+	{"arena", arena},
+	{"cells", cells},
+	{"lazy", lazy},
+	{"scroll", scrolled},
+	{"tasks", tasks},
+	{"animated", animated},
+	{"table", table},
+	{"log", logged},
+	{"sparkline", sparkline},
+	{"panel", panel},
+};
+
+// Writes the cells of the screen as text and styles
+static std::string dump(const NTFrameBuffer &frame)
+{
+	std::ostringstream text;
+	std::map<std::pair<attr_t, short>, char> styles;
+	std::vector<std::pair<attr_t, short>> order;
+	const nt::Rect &area = frame.area();
+
+	for (int y = 0; y < area.height; y++) {
+		std::string glyphs, marks;
+		for (int x = 0; x < area.width; x++) {
+			const NTFrameBuffer::Cell &cell = *frame.at(x, y);
+			if (!(cell.flags & NTF_CONTINUATION)) {
+				for (int i = 0; i < CCHARW_MAX && cell.text[i]; i++) {
+					char bytes[4];
+					glyphs.append(bytes, nt::encode(static_cast<char32_t>(cell.text[i]), bytes));
+				}
+			}
+
+			auto style = std::make_pair(cell.attr, cell.pair);
+			char mark = '.';
+			if (cell.attr != A_NORMAL || cell.pair != 0) {
+				auto it = styles.find(style);
+				if (it == styles.end()) {
+					it = styles.emplace(style, static_cast<char>('a' + styles.size() % 26)).first;
+					order.push_back(style);
+				}
+				mark = it->second;
+			}
+			marks.push_back(mark);
+		}
+		text << std::setw(2) << y << " |" << glyphs << "|   |" << marks << "|\n";
+	}
+	for (const auto &style : order) {
+		text << "   " << styles[style] << " = attr 0x" << std::hex << style.first << std::dec << " pair " << style.second << "\n";
+	}
+	return text.str();
+}
+
+// Reads a file
+static bool load(const std::string &path, std::string &data)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) return false;
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	data = stream.str();
+	return true;
+}
+
+// Checks that the mirror shows the clipped frame in the colors of the screen
+static bool mirrors(const NTFrameBuffer &frame, SCREEN *terminal, SCREEN *mirror)
+{
+	NTFrameBuffer shown;
+	std::map<short, std::pair<short, short>> colors;
+	set_term(mirror);
+	shown.capture(stdscr);
+	for (int i = 0; i < shown.area().width * shown.area().height; i++) {
+		short pair = shown.at(0, 0)[i].pair;
+		if (pair > 0 && !colors.count(pair)) pair_content(pair, &colors[pair].first, &colors[pair].second);
+	}
+	set_term(terminal);
+
+	nt::Size size = {mirrorWidth, mirrorHeight};
+	for (int y = 0; y < mirrorHeight; y++) {
+		for (int x = 0; x < mirrorWidth; x++) {
+			NTFrameBuffer::Cell expected = frame.shown(x, y, size);
+			const NTFrameBuffer::Cell &cell = *shown.at(x, y);
+			if (std::wcscmp(cell.text, expected.text) != 0 || cell.attr != expected.attr || cell.pair != expected.pair) return false;
+		}
+	}
+	for (const auto &color : colors) {
+		short foreground, background;
+		pair_content(color.first, &foreground, &background);
+		if (foreground != color.second.first || background != color.second.second) return false;
+	}
+	return true;
+}
+
+// Draws a scene with a compositor and checks its frames
+static bool run(const SceneType &type, bool tiles, const std::string &directory, bool update, FILE *output, SCREEN *terminal, SCREEN *mirror)
+{
+	Scene scene;
+	type.build(scene);
+	NTCursesSink sink(nullptr, mirror);
+	NTScreen screen;
+	NTTileRenderer renderer(2);
+	for (NTGraphicObject *object : scene.objects) {
+		if (tiles) renderer.add(object);
+		else screen.add(object);
+	}
+	if (tiles) renderer.attach(&sink);
+	else screen.attach(&sink);
+	if (tiles) renderer.setTaskPool(scene.pool.get());
+	else screen.setTaskPool(scene.pool.get());
+
+	const char *compositor = tiles ? "tiles" : "screen";
+	clear();
+	refresh();
+	bool passed = true;
+	std::string frames;
+	NTFrameBuffer frame;
+	for (size_t i = 0; i <= scene.changes.size(); i++) {
+		if (i > 0) scene.changes[i - 1]();
+
+		std::fflush(output);
+		long before = std::ftell(output);
+		if (tiles) renderer.draw();
+		else screen.draw();
+		std::fflush(output);
+		long bytes = std::ftell(output) - before;
+
+		frame.capture(stdscr);
+		frames += "frame " + std::to_string(i) + "\n" + dump(frame);
+		if (!mirrors(frame, terminal, mirror)) {
+			std::cerr << type.name << " (" << compositor << ") frame " << i << ": the mirror differs from the screen" << std::endl;
+			passed = false;
+		}
+
+		const Limits &limits = scene.limits[i];
+		if (tiles && renderer.written() > limits.cells) {
+			std::cerr << type.name << " (" << compositor << ") frame " << i << ": " << renderer.written()
+					  << " cells written, at most " << limits.cells << " expected" << std::endl;
+			passed = false;
+		}
+		if (bytes > limits.bytes) {
+			std::cerr << type.name << " (" << compositor << ") frame " << i << ": " << bytes
+					  << " bytes emitted, at most " << limits.bytes << " expected" << std::endl;
+			passed = false;
+		}
+	}
+
+	// Both compositors must show the same golden frames
+	std::string path = directory + "/" + type.name + ".txt";
+	std::string golden;
+	if (update && tiles) {
+		std::ofstream file(path, std::ios::binary);
+		file << frames;
+		if (!file) {
+			std::cerr << path << ": can not write" << std::endl;
+			return false;
+		}
+	} else if (!load(path, golden)) {
+		std::cerr << path << ": no golden frames (run with -u to create them)" << std::endl;
+		return false;
+	} else if (golden != frames) {
+		std::cerr << type.name << " (" << compositor << "): frames differ from " << path << std::endl
+				  << "--- expected" << std::endl << golden << "--- drawn" << std::endl << frames;
+		passed = false;
+	}
+
+	if (tiles) renderer.detach(&sink);
+	else screen.detach(&sink);
+	for (NTGraphicObject *object : scene.objects) {
+		if (tiles) renderer.remove(object);
+		else screen.remove(object);
+	}
+	return passed;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string directory = "tests/golden";
+	bool update = false;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "-u") {
+			update = true;
+		} else if (arg[0] != '-') {
+			directory = arg;
+		} else {
+			std::cerr << "Usage: ntgolden [-u] [golden directory]" << std::endl
+					  << "  -u  write the golden frames from the tile renderer" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Headless terminals: the output goes to a file, so its size is the bytes sent
+	setlocale(LC_ALL, "C.UTF-8");
+	// (each one is set up before the next is created)
+	FILE *mirrorOutput = std::tmpfile();
+	SCREEN *mirror = mirrorOutput ? newterm("xterm-256color", mirrorOutput, stdin) : nullptr;
+	if (!mirror) {
+		std::cerr << "Can not open a headless terminal" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// The mirror knows no color pairs: the sink copies them
+	resizeterm(mirrorHeight, mirrorWidth);
+	curs_set(0);
+	start_color();
+	use_default_colors();
+
+	FILE *output = std::tmpfile();
+	SCREEN *terminal = output ? newterm("xterm-256color", output, stdin) : nullptr;
+	if (!terminal) {
+		std::cerr << "Can not open a headless terminal" << std::endl;
+		return EXIT_FAILURE;
+	}
+	set_term(terminal);
+	resizeterm(screenHeight, screenWidth);
+	curs_set(0);
+	start_color();
+	use_default_colors();
+	init_pair(1, COLOR_RED, -1);
+	init_pair(2, COLOR_GREEN, COLOR_BLACK);
+	init_pair(3, COLOR_YELLOW, COLOR_BLUE);
+
+	int failed = 0;
+	for (const SceneType &type : scenes) {
+		for (bool tiles : {true, false}) {
+			if (run(type, tiles, directory, update, output, terminal, mirror)) continue;
+			failed++;
+		}
+	}
+	endwin();
+	set_term(mirror);
+	endwin();
+	set_term(terminal);
+	delscreen(mirror);
+	delscreen(terminal);
+	std::fclose(mirrorOutput);
+	std::fclose(output);
+
+	std::cout << (sizeof(scenes) / sizeof(scenes[0])) * 2 - failed << " passed, " << failed << " failed" << std::endl;
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}